@@ -0,0 +1,80 @@
+#ifndef EVA_CSV_READER_H
+#define EVA_CSV_READER_H
+
+#include "evaConstants.h"
+#include "mappedFile.h"
+
+#include <string>
+#include <vector>
+
+namespace eva
+{
+	class CsvReader
+	{
+		// Memory-maps a csv file and splits its rows into fields without copying.
+		// The fields point into the mapped file, and are valid until the next row is read.
+
+	public:
+		struct Field
+		{
+			const char* begin = nullptr;
+			const char* end = nullptr;
+
+			inline const bool empty() const { return begin == end; };
+			inline const std::string str() const { return std::string(begin, end); };
+
+			// Parse the field like atoi/atof: leading whitespace is skipped, and the parsing stops at the first invalid character.
+			const int64_t to_int() const;
+			const double to_double() const;
+			inline const Types::DateTime to_dateTime() const { return Helper::StringToDateTime(begin, end); };
+		};
+
+	private:
+		// ATTRIBUTES
+
+		MappedFile _file;
+
+		const char* _cursor = nullptr;
+		const char* _lineBegin = nullptr;
+		const char* _lineEnd = nullptr;
+		bool _firstLine = true;
+
+		std::vector<Field> _vecFields;
+		const Field _emptyField;
+
+		// FUNCTION DEFINITIONS
+
+		void _split();
+
+	public:
+		// CONSTRUCTORS
+
+		// @ brief Default Constructor
+		CsvReader() {};
+		CsvReader(const CsvReader&) = delete;
+		CsvReader& operator=(const CsvReader&) = delete;
+
+		// DESTRUCTOR
+
+		// @ brief Destructor
+		~CsvReader() { close(); };
+
+		// FUNCTION DEFINITIONS
+
+		// Returns false, if the file cannot be opened:
+		bool open(const std::string& fileName);
+		void close();
+
+		// Moves to the next data row. Skips a leading "sep=" line, the header, comments and empty lines:
+		bool next_row();
+
+		// INLINE
+		// GETTERS
+
+		inline const Field& get_field(const size_t& index) const { return index < _vecFields.size() ? _vecFields[index] : _emptyField; };
+		inline const size_t get_nrFields() const { return _vecFields.size(); };
+		inline const std::string get_line() const { return std::string(_lineBegin, _lineEnd); };
+	};
+}
+
+#endif // EVA_CSV_READER_H
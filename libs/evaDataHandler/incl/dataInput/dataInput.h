@@ -19,6 +19,13 @@ namespace eva {
 		Vehicles _vehicles;
 		Maintenances _maintenances;
 
+		// FUNCTION DEFINITIONS:
+
+		// Reads the data from the instance cache. Returns false, if the cache does not exist, was written for other csv files or is corrupted:
+		bool _readInstanceCache(const std::string& fileName, const uint64_t& instanceKey);
+		void _writeInstanceCache(const std::string& fileName, const uint64_t& instanceKey) const;
+		void _initialiseChargerTravel();
+
 	public:
 		DataInput()	{};
 
@@ -11,6 +11,9 @@
 
 namespace eva
 {
+	class BinaryReader;
+	class BinaryWriter;
+
 	class Chargers
 	{
 	private:
@@ -21,6 +24,8 @@ namespace eva
 
 		// FUNCTION DEFINITIONS
 
+		void _initialiseMapId();
+
 	public:
 		// CONSTRUCTORS
 
@@ -36,6 +41,8 @@ namespace eva
 
 		const Charger& get_chargerFromId(const uint32_t& id) const;
 		void read(const std::string& fileName, const Locations& locations);
+		void readBinary(BinaryReader& in, const Locations& locations);
+		void writeBinary(BinaryWriter& out) const;
 		void clear();
 
 		// INLINE
@@ -53,6 +53,7 @@ namespace eva
         double _const_linear_optimality_gap = 0.0001;
         double _const_integer_optimality_gap = 0.001;
         double _const_frac_threshold_trunc_cg = 0.9;
+        double _const_dual_smoothing_alpha = 0.5; //!< The initial smoothing parameter of the dual stabilisation. Adjusted automatically during column generation.
 
         uint32_t _const_put_vehicle_on_charge = 1 * 5 * 60; //!< A constant duration that must be reserved to put the vehicle on charge.
         uint32_t _const_take_vehicle_off_charge = 1 * 5 * 60; //!< A constant duration that must be reserved to take the vehicle off charge.
@@ -65,6 +66,8 @@ namespace eva
         uint32_t _const_nr_cols_per_vehicle_iter = 40;
         uint32_t _const_nth_iter_solve_all = 10;
         uint32_t _const_nth_branching_node_dive = 10;
+        uint32_t _const_nth_iter_model_clean = 10;
+        uint32_t _const_del_consecutive_pos_rc = 25;
         uint32_t _const_max_number_cols_mp = 5000;
         uint32_t _const_max_number_cols_mp_pool = 10000;
         uint32_t _const_max_number_first_tier_eval_strong_branching = 50;
@@ -79,6 +82,15 @@ namespace eva
         bool _flag_interim_solve_all_vehicles = true;           
         bool _flag_allow_deadlegs = true;         
         bool _flag_terminate_after_root = false;  
+        bool _flag_incremental_reduced_graph = true;
+        bool _flag_dual_stabilisation = false;
+        bool _flag_parallel_strong_branching = false;
+        bool _flag_parallel_tree_search = false;
+        bool _flag_horizon_warm_start = false;
+        bool _flag_instance_cache = false;
+        bool _flag_tsn_charging_chains = false;
+        bool _flag_lagrangian_termination = false;
+        bool _flag_adaptive_vehicle_selection = false;
 
         // Cost Coefficients:
         double _cost_deadleg_fix = 5.0;
@@ -128,6 +140,7 @@ namespace eva
         inline const double& get_const_linear_optimality_gap() const { return _const_linear_optimality_gap; };
         inline const double& get_const_integer_optimality_gap() const { return _const_integer_optimality_gap; };
         inline const double& get_const_frac_threshold_trunc_cg() const { return _const_frac_threshold_trunc_cg; };
+        inline const double& get_const_dual_smoothing_alpha() const { return _const_dual_smoothing_alpha; };
 
         inline const uint32_t& get_const_put_vehicle_on_charge() const { return _const_put_vehicle_on_charge; };
         inline const uint32_t& get_const_take_vehicle_off_charge() const { return _const_take_vehicle_off_charge; };
@@ -141,6 +154,8 @@ namespace eva
         inline const uint32_t& get_const_nr_cols_per_vehicle_iter() const { return _const_nr_cols_per_vehicle_iter; };
         inline const uint32_t& get_const_nth_iter_solve_all() const { return _const_nth_iter_solve_all; };
         inline const uint32_t& get_const_nth_branching_node_dive() const { return _const_nth_branching_node_dive; };
+        inline const uint32_t& get_const_nth_iter_model_clean() const { return _const_nth_iter_model_clean; };
+        inline const uint32_t& get_const_del_consecutive_pos_rc() const { return _const_del_consecutive_pos_rc; };
         inline const uint32_t& get_const_max_number_cols_mp() const { return _const_max_number_cols_mp; };
         inline const uint32_t& get_const_max_number_cols_mp_pool() const { return _const_max_number_cols_mp_pool; };
         inline const uint32_t& get_const_max_number_first_tier_eval_strong_branching() const { return _const_max_number_first_tier_eval_strong_branching; };
@@ -151,6 +166,15 @@ namespace eva
         inline const bool get_flag_interim_solve_all_vehicles() const { return _flag_interim_solve_all_vehicles; };
         inline const bool get_flag_allow_deadlegs() const { return _flag_allow_deadlegs; };
         inline const bool get_flag_terminate_after_root() const { return _flag_terminate_after_root; };
+        inline const bool get_flag_incremental_reduced_graph() const { return _flag_incremental_reduced_graph; };
+        inline const bool get_flag_dual_stabilisation() const { return _flag_dual_stabilisation; };
+        inline const bool get_flag_parallel_strong_branching() const { return _flag_parallel_strong_branching; };
+        inline const bool get_flag_parallel_tree_search() const { return _flag_parallel_tree_search; };
+        inline const bool get_flag_horizon_warm_start() const { return _flag_horizon_warm_start; };
+        inline const bool get_flag_instance_cache() const { return _flag_instance_cache; };
+        inline const bool get_flag_tsn_charging_chains() const { return _flag_tsn_charging_chains; };
+        inline const bool get_flag_lagrangian_termination() const { return _flag_lagrangian_termination; };
+        inline const bool get_flag_adaptive_vehicle_selection() const { return _flag_adaptive_vehicle_selection; };
 
         inline const double& get_cost_deadleg_fix() const { return _cost_deadleg_fix; };
         inline const double& get_cost_deadleg_per_km() const { return _cost_deadleg_per_km; };
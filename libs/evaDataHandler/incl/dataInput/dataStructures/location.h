@@ -2,6 +2,8 @@
 #define EVA_LOCATION_H
 
 #include "evaConstants.h"
+#include "travelMatrix.h"
+
 #include <string>
 #include <vector>
 
@@ -42,7 +44,7 @@ namespace eva
 		Location::LocationType _type;
 		std::string _name;
 
-		std::vector<Measures> _vecMeasures;
+		const TravelMatrix* _ptrTravelMatrix = nullptr; // Owned by the Locations.
 
 		// FUNCTION DEFINITIONS	
 
@@ -66,19 +68,19 @@ namespace eva
 
 		static const Location::LocationType string2type(const std::string& str);
 		
-		// GETTERS
+		inline void set_travelMatrix(const TravelMatrix* ptrTravelMatrix) { _ptrTravelMatrix = ptrTravelMatrix; };
 
-		std::vector<Measures>& get_vecMeasures() { return _vecMeasures; };
+		// GETTERS
 
 		inline const Types::Index& get_index() const { return _index; };
 		inline const uint32_t& get_id() const { return _id; };
 		inline const Location::LocationType& get_type() const { return _type; };
 		inline const std::string& get_name() const { return _name; };
 
-		inline const uint32_t get_distanceToLocation(const Location& location) const { return _vecMeasures[location.get_index()].distance; };
-		inline const uint32_t get_distanceToLocation(const Types::Index& locationIndex) const { return _vecMeasures[locationIndex].distance; };
-		inline const uint32_t get_durationToLocation(const Location& location) const { return _vecMeasures[location.get_index()].duration; };
-		inline const uint32_t get_durationToLocation(const Types::Index& locationIndex) const { return _vecMeasures[locationIndex].duration; };
+		inline const uint32_t get_distanceToLocation(const Location& location) const { return _ptrTravelMatrix->get_distance(_index, location.get_index()); };
+		inline const uint32_t get_distanceToLocation(const Types::Index& locationIndex) const { return _ptrTravelMatrix->get_distance(_index, locationIndex); };
+		inline const uint32_t get_durationToLocation(const Location& location) const { return _ptrTravelMatrix->get_duration(_index, location.get_index()); };
+		inline const uint32_t get_durationToLocation(const Types::Index& locationIndex) const { return _ptrTravelMatrix->get_duration(_index, locationIndex); };
 
 	};
 }
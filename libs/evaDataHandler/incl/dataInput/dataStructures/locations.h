@@ -9,6 +9,9 @@
 
 namespace eva
 {
+	class BinaryReader;
+	class BinaryWriter;
+
 	class Locations
 	{
 	private:
@@ -16,15 +19,22 @@ namespace eva
 
 		std::vector<Location> _vec;
 		std::unordered_map<uint32_t, Types::Index> _mapId;
+		TravelMatrix _travelMatrix;
 
 		// FUNCTION DEFINITIONS
 
+		void _initialiseMapId();
+
 	public:
 		// CONSTRUCTORS
 
 		// @ brief Default Constructor
 		Locations() {};
 
+		// The locations point to the travel matrix of this object, hence it cannot be copied:
+		Locations(const Locations&) = delete;
+		Locations& operator=(const Locations&) = delete;
+
 		// DESTRUCTOR
 
 		// @ brief Destructor
@@ -36,6 +46,9 @@ namespace eva
 		Location& get_locationFromId(const uint32_t& id);
 		void read(const std::string& fileName);
 		void readTravel(const std::string& fileName);
+		void readBinary(BinaryReader& in);
+		void writeBinary(BinaryWriter& out) const;
+		void initialiseChargerTravel(const std::vector<Types::Index>& vecChargerLocationIndexes) { _travelMatrix.initialiseChargers(vecChargerLocationIndexes); };
 		void clear();
 
 		// INLINE
@@ -43,6 +56,7 @@ namespace eva
 
 		const std::vector<Location>& get_vec() const { return _vec; }
 		const Location& get_location(const Types::Index& indexLocation) const { return _vec[indexLocation]; }
+		const TravelMatrix& get_travelMatrix() const { return _travelMatrix; }
 		
 	};
 }
@@ -12,6 +12,9 @@
 
 namespace eva
 {
+	class BinaryReader;
+	class BinaryWriter;
+
 	class Maintenances
 	{
 	private:
@@ -25,6 +28,8 @@ namespace eva
 
 		// FUNCTION DEFINITIONS
 
+		void _initialiseMapId(const Vehicles& vehicles);
+
 	public:
 		// CONSTRUCTORS
 
@@ -40,6 +45,8 @@ namespace eva
 
 		const Maintenance& get_maintenanceFromId(const uint32_t& id) const;
 		void read(const std::string& fileName, const Locations& locations, const Config& config, const Vehicles& vehicles);
+		void readBinary(BinaryReader& in, const Locations& locations, const Vehicles& vehicles);
+		void writeBinary(BinaryWriter& out) const;
 		void clear();
 
 		// INLINE
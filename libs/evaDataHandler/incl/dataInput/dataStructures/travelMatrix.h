@@ -0,0 +1,100 @@
+#ifndef EVA_TRAVEL_MATRIX_H
+#define EVA_TRAVEL_MATRIX_H
+
+#include "evaConstants.h"
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace eva
+{
+	template <class T, size_t Alignment>
+	struct AlignedAllocator
+	{
+		typedef T value_type;
+
+		template <class U> struct rebind { typedef AlignedAllocator<U, Alignment> other; };
+
+		AlignedAllocator() {};
+		template <class U> AlignedAllocator(const AlignedAllocator<U, Alignment>&) {};
+
+		T* allocate(const size_t n)
+		{
+			void* ptr = nullptr;
+			if (posix_memalign(&ptr, Alignment, n * sizeof(T)) != 0)
+				throw std::bad_alloc();
+			return static_cast<T*>(ptr);
+		};
+		void deallocate(T* ptr, const size_t) { std::free(ptr); };
+
+		template <class U> bool operator==(const AlignedAllocator<U, Alignment>&) const { return true; };
+		template <class U> bool operator!=(const AlignedAllocator<U, Alignment>&) const { return false; };
+	};
+
+	class TravelMatrix
+	{
+		// Distances and durations between all pairs of locations, stored in separate row-major arrays.
+		// Every row starts on a new cache line. Additionally, each location holds a contiguous table
+		// of the travel to and from every charger, and its nearest charger.
+
+	public:
+		static const size_t CACHE_LINE_SIZE = 64;
+		typedef std::vector<uint32_t, AlignedAllocator<uint32_t, CACHE_LINE_SIZE>> AlignedVector;
+
+	private:
+		// ATTRIBUTES
+
+		uint32_t _nrLocations = 0;
+		uint32_t _rowStride = 0;
+		AlignedVector _vecDistances;
+		AlignedVector _vecDurations;
+
+		uint32_t _nrChargers = 0;
+		AlignedVector _vecDistancesToChargers;
+		AlignedVector _vecDurationsToChargers;
+		AlignedVector _vecDistancesFromChargers;
+		AlignedVector _vecDurationsFromChargers;
+		std::vector<Types::Index> _vecNearestCharger;
+
+	public:
+		// CONSTRUCTORS
+
+		// @ brief Default Constructor
+		TravelMatrix() {};
+
+		// FUNCTION DEFINITIONS
+
+		// Sets all measures to Constants::BIG_UINTEGER, i.e. no travel possible:
+		void initialise(const uint32_t& nrLocations);
+
+		// Builds the charger tables from the location of each charger, after all measures are set:
+		void initialiseChargers(const std::vector<Types::Index>& vecChargerLocationIndexes);
+
+		void clear();
+
+		inline void set(const Types::Index& from, const Types::Index& to, const uint32_t& distance, const uint32_t& duration)
+		{
+			_vecDistances[size_t(from) * _rowStride + to] = distance;
+			_vecDurations[size_t(from) * _rowStride + to] = duration;
+		};
+
+		// INLINE
+		// GETTERS
+
+		inline const uint32_t& get_nrLocations() const { return _nrLocations; };
+
+		inline const uint32_t& get_distance(const Types::Index& from, const Types::Index& to) const { return _vecDistances[size_t(from) * _rowStride + to]; };
+		inline const uint32_t& get_duration(const Types::Index& from, const Types::Index& to) const { return _vecDurations[size_t(from) * _rowStride + to]; };
+
+		inline const uint32_t& get_distanceToCharger(const Types::Index& location, const Types::Index& charger) const { return _vecDistancesToChargers[size_t(location) * _nrChargers + charger]; };
+		inline const uint32_t& get_durationToCharger(const Types::Index& location, const Types::Index& charger) const { return _vecDurationsToChargers[size_t(location) * _nrChargers + charger]; };
+		inline const uint32_t& get_distanceFromCharger(const Types::Index& charger, const Types::Index& location) const { return _vecDistancesFromChargers[size_t(location) * _nrChargers + charger]; };
+		inline const uint32_t& get_durationFromCharger(const Types::Index& charger, const Types::Index& location) const { return _vecDurationsFromChargers[size_t(location) * _nrChargers + charger]; };
+
+		// Charger with the shortest distance from the location, or Constants::BIG_INDEX if no charger can be reached:
+		inline const Types::Index& get_nearestCharger(const Types::Index& location) const { return _vecNearestCharger[location]; };
+	};
+}
+
+#endif // EVA_TRAVEL_MATRIX_H
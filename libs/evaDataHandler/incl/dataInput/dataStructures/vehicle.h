@@ -95,6 +95,7 @@ namespace eva
 		inline const uint32_t& get_odometerLastMaintenance() const { return _odometerLastMaintenance; };
 		inline const bool get_inRotation() const { return _inRotation; };
 		inline const double& get_cost() const { return _cost; };
+		inline const Types::BatteryCharge& get_kwhPerThousandKm() const { return _kwh_per_thousand_km; };
 
 		inline const uint32_t get_distanceRange() const { return ((_batteryMaxKWh - _batteryMinKWh) * 1000) / _kwh_per_thousand_km; };
 		inline const Types::BatteryCharge get_batteryRange() const { return _batteryMaxKWh - _batteryMinKWh; };
@@ -10,6 +10,9 @@
 
 namespace eva
 {
+	class BinaryReader;
+	class BinaryWriter;
+
 	class Vehicles
 	{
 	private:
@@ -20,6 +23,8 @@ namespace eva
 
 		// FUNCTION DEFINITIONS
 
+		void _initialiseMapId();
+
 	public:
 		// CONSTRUCTORS
 
@@ -35,6 +40,8 @@ namespace eva
 
 		const Vehicle& get_vehicleFromId(const uint32_t& id) const;
 		void read(const std::string& fileName, const Chargers& chargers);
+		void readBinary(BinaryReader& in, const Chargers& chargers);
+		void writeBinary(BinaryWriter& out) const;
 		void clear();
 
 		// INLINE
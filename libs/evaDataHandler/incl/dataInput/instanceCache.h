@@ -0,0 +1,80 @@
+#ifndef EVA_INSTANCE_CACHE_H
+#define EVA_INSTANCE_CACHE_H
+
+#include "evaConstants.h"
+#include "mappedFile.h"
+#include "dataStructures/config.h"
+
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace eva
+{
+	class BinaryWriter
+	{
+		// Writes into a temporary file, which only replaces the target file on commit.
+		// Concurrent runs on the same data set therefore never see a partially written file.
+
+		std::ofstream _out;
+		std::string _fileName;
+		std::string _tmpFileName;
+
+	public:
+		BinaryWriter() {};
+		BinaryWriter(const BinaryWriter&) = delete;
+		BinaryWriter& operator=(const BinaryWriter&) = delete;
+		~BinaryWriter();
+
+		bool open(const std::string& fileName);
+		bool commit();
+
+		template <class T> void write(const T& value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be written.");
+			_out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+		};
+		void write_string(const std::string& str);
+	};
+
+	class BinaryReader
+	{
+		MappedFile _file;
+		const char* _cursor = nullptr;
+		const char* _end = nullptr;
+
+		void _require(const size_t& size) const;
+
+	public:
+		BinaryReader() {};
+		BinaryReader(const BinaryReader&) = delete;
+		BinaryReader& operator=(const BinaryReader&) = delete;
+
+		bool open(const std::string& fileName);
+
+		template <class T> T read()
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be read.");
+			_require(sizeof(T));
+			T value;
+			std::memcpy(&value, _cursor, sizeof(T));
+			_cursor += sizeof(T);
+			return value;
+		};
+		std::string read_string();
+	};
+
+	struct InstanceCache
+	{
+		static const uint64_t MAGIC;
+		static const uint32_t VERSION;
+
+		// Content hash of the csv files, combined with the config parameters that filter the data while reading.
+		// Returns 0, if any of the files cannot be opened:
+		static const uint64_t hash(const std::vector<std::string>& vecFileNames, const Config& config);
+	};
+}
+
+#endif // EVA_INSTANCE_CACHE_H
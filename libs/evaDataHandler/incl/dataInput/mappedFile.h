@@ -0,0 +1,45 @@
+#ifndef EVA_MAPPED_FILE_H
+#define EVA_MAPPED_FILE_H
+
+#include <string>
+
+namespace eva
+{
+	class MappedFile
+	{
+		// Read-only memory mapping of a whole file. The data is valid until the file is closed.
+
+		// ATTRIBUTES
+
+		int _fileDescriptor = -1;
+		const char* _data = nullptr;
+		size_t _size = 0;
+
+	public:
+		// CONSTRUCTORS
+
+		// @ brief Default Constructor
+		MappedFile() {};
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		// DESTRUCTOR
+
+		// @ brief Destructor
+		~MappedFile() { close(); };
+
+		// FUNCTION DEFINITIONS
+
+		// Returns false, if the file cannot be opened:
+		bool open(const std::string& fileName);
+		void close();
+
+		// INLINE
+		// GETTERS
+
+		inline const char* get_data() const { return _data; };
+		inline const size_t& get_size() const { return _size; };
+	};
+}
+
+#endif // EVA_MAPPED_FILE_H
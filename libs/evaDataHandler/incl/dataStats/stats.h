@@ -29,7 +29,15 @@ namespace eva
 			int64_t pp_network_construction_ms = 0;
 			uint32_t pp_network_size_nodes = 0;
 			uint32_t pp_network_size_arcs = 0;
+			uint32_t pp_segments_skipped = 0;
 			const char* lazy_constraint_added = NULL;
+			double stabilisation_alpha = 0.0;
+			uint32_t stabilisation_misPricings = 0;
+			double lb_lagrangian = -Constants::BIG_DOUBLE; //!< The lagrangian lower bound of the iteration, only set if the pricing problem was solved to optimality.
+			const char* early_termination = NULL;
+			const char* pp_vehicle_selection = NULL; //!< The policy that orders the vehicles of the partial pricing.
+			uint64_t pp_vehicles_priced = 0;
+			uint64_t pp_vehicles_improving = 0; //!< The priced vehicles that yielded a negative reduced cost schedule.
 
 			const char* branchType = NULL;
 			Types::Index indexParentBranchingNode = Constants::BIG_INDEX;
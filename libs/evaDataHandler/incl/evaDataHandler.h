@@ -6,6 +6,8 @@
 #include "dataOutput/dataOutput.h"
 #include "dataStats/stats.h"
 
+#include <mutex>
+
 namespace eva 
 {
 	struct VehicleSchedule
@@ -37,6 +39,7 @@ namespace eva
 		DataOutput _output; // Stores the functions to write the output.
 
 		Stats _stats; // Stores the stats of the software.
+		std::mutex _mutexStats; // Guards the performance details, which may be stored from concurrent strong branching evaluations.
 		ScheduleGraph _scheduleGraph; // Stores all schedule activities in graph form.
 
 
@@ -55,7 +58,7 @@ namespace eva
 		// FUNCTION DEFINITIONS
 		void storeSolution(const Solution& solution); // In this, add the arcs to the schedule graph, store the schedule path, and store the stats.
 		void storeStatsPlanningHorizon(const Stats::PlanningHorizon& ph) { _stats.add_statsPlanningHorizon(ph); };
-		void storeStatsPerformanceDetail(const Stats::PerformanceDetail& pd) { _stats.add_statsPerformanceDetail(pd); };
+		void storeStatsPerformanceDetail(const Stats::PerformanceDetail& pd) { std::lock_guard<std::mutex> lock(_mutexStats); _stats.add_statsPerformanceDetail(pd); };
 		void storeStatsVehicles();
 		void storeStatsChargers();
 		void storeStatsSchedules();
@@ -0,0 +1,172 @@
+#include "incl/dataInput/csvReader.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+	inline bool is_digit(const char c) { return c >= '0' && c <= '9'; };
+
+	inline bool contains(const char* begin, const char* end, const char* str)
+	{
+		return std::search(begin, end, str, str + std::strlen(str)) != end;
+	};
+}
+
+bool eva::CsvReader::open(const std::string& fileName)
+{
+	close();
+
+	if (!_file.open(fileName))
+		return false;
+
+	_cursor = _lineBegin = _lineEnd = _file.get_data();
+	_firstLine = true;
+
+	return true;
+}
+
+void eva::CsvReader::close()
+{
+	_file.close();
+	_cursor = _lineBegin = _lineEnd = nullptr;
+	_vecFields.clear();
+}
+
+bool eva::CsvReader::next_row()
+{
+	const char* endOfFile = _file.get_data() + _file.get_size();
+
+	while (_cursor != nullptr && _cursor < endOfFile)
+	{
+		// Cut the line at the new line, and remove the carriage return symbol:
+		_lineBegin = _cursor;
+		const char* newLine = static_cast<const char*>(std::memchr(_cursor, '\n', endOfFile - _cursor));
+		_lineEnd = newLine != nullptr ? newLine : endOfFile;
+		_cursor = newLine != nullptr ? newLine + 1 : endOfFile;
+
+		const char* carriageReturn = static_cast<const char*>(std::memchr(_lineBegin, '\r', _lineEnd - _lineBegin));
+		if (carriageReturn != nullptr)
+			_lineEnd = carriageReturn;
+
+		// If this is the first line, then we may have a "sep=," command.
+		// If so, then skip the line.
+		if (_firstLine) {
+			_firstLine = false;
+			if (contains(_lineBegin, _lineEnd, "sep"))
+				continue;
+		}
+
+		// Skip empty lines, the header and comments:
+		if (_lineBegin == _lineEnd
+			|| contains(_lineBegin, _lineEnd, "Id")
+			|| std::memchr(_lineBegin, '#', _lineEnd - _lineBegin) != nullptr)
+			continue;
+
+		_split();
+		return true;
+	}
+
+	_vecFields.clear();
+	return false;
+}
+
+void eva::CsvReader::_split()
+{
+	// The field vector keeps its capacity over all rows, hence no allocations after the first row:
+	_vecFields.clear();
+
+	const char* fieldBegin = _lineBegin;
+	while (true)
+	{
+		const char* comma = static_cast<const char*>(std::memchr(fieldBegin, ',', _lineEnd - fieldBegin));
+		Field field;
+		field.begin = fieldBegin;
+		field.end = comma != nullptr ? comma : _lineEnd;
+		_vecFields.push_back(field);
+
+		if (comma == nullptr)
+			break;
+		fieldBegin = comma + 1;
+	}
+}
+
+const int64_t eva::CsvReader::Field::to_int() const
+{
+	const char* pos = begin;
+	while (pos != end && (*pos == ' ' || *pos == '\t'))
+		++pos;
+
+	bool negative = false;
+	if (pos != end && (*pos == '-' || *pos == '+'))
+		negative = *pos++ == '-';
+
+	int64_t res = 0;
+	for (; pos != end && is_digit(*pos); ++pos)
+		res = res * 10 + (*pos - '0');
+
+	return negative ? -res : res;
+}
+
+const double eva::CsvReader::Field::to_double() const
+{
+	// Powers of ten that are exactly representable as a double:
+	static const double POW10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+	static const uint64_t MAX_EXACT_MANTISSA = uint64_t(1) << 53;
+
+	const char* pos = begin;
+	while (pos != end && (*pos == ' ' || *pos == '\t'))
+		++pos;
+
+	bool negative = false;
+	if (pos != end && (*pos == '-' || *pos == '+'))
+		negative = *pos++ == '-';
+
+	// Mantissa and decimal exponent:
+	uint64_t mantissa = 0;
+	int32_t exponent = 0;
+	uint32_t nrDigits = 0;
+	for (; pos != end && is_digit(*pos); ++pos, ++nrDigits)
+		mantissa = mantissa * 10 + (*pos - '0');
+
+	if (pos != end && *pos == '.')
+		for (++pos; pos != end && is_digit(*pos); ++pos, ++nrDigits, --exponent)
+			mantissa = mantissa * 10 + (*pos - '0');
+
+	if (pos != end && (*pos == 'e' || *pos == 'E'))
+	{
+		const char* posExponent = pos + 1;
+		bool negativeExponent = false;
+		if (posExponent != end && (*posExponent == '-' || *posExponent == '+'))
+			negativeExponent = *posExponent++ == '-';
+
+		if (posExponent != end && is_digit(*posExponent))
+		{
+			int32_t explicitExponent = 0;
+			for (; posExponent != end && is_digit(*posExponent); ++posExponent)
+				explicitExponent = std::min(explicitExponent * 10 + (*posExponent - '0'), 10000);
+			exponent += negativeExponent ? -explicitExponent : explicitExponent;
+		}
+	}
+
+	// Exact mantissa and power of ten: a single multiplication or division is correctly rounded.
+	// Anything else is handed to strtod, which requires a null-terminated copy:
+	if (nrDigits <= 15 && mantissa < MAX_EXACT_MANTISSA && exponent >= -22 && exponent <= 22)
+	{
+		double res = double(mantissa);
+		res = exponent < 0 ? res / POW10[-exponent] : res * POW10[exponent];
+		return negative ? -res : res;
+	}
+
+	char buffer[64];
+	if (size_t(end - begin) < sizeof(buffer))
+	{
+		std::memcpy(buffer, begin, end - begin);
+		buffer[end - begin] = '\0';
+		return std::strtod(buffer, nullptr);
+	}
+
+	return std::strtod(str().c_str(), nullptr);
+}
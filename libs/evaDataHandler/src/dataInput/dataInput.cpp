@@ -1,12 +1,77 @@
 #include "incl/dataInput/dataInput.h"
+#include "incl/dataInput/instanceCache.h"
+
+#include "evaExceptions.h"
 
 #include <iostream>
+#include <future>
 
 void eva::DataInput::clear()
 {
+	_maintenances.clear();
+	_vehicles.clear();
+	_trips.clear();
+	_chargers.clear();
 	_locations.clear();
 }
 
+bool eva::DataInput::_readInstanceCache(const std::string& fileName, const uint64_t& instanceKey)
+{
+	BinaryReader in;
+	if (instanceKey == 0 || !in.open(fileName))
+		return false;
+
+	try
+	{
+		if (in.read<uint64_t>() != InstanceCache::MAGIC
+			|| in.read<uint32_t>() != InstanceCache::VERSION
+			|| in.read<uint64_t>() != instanceKey)
+			return false;
+
+		_locations.readBinary(in);
+		_chargers.readBinary(in, _locations);
+		_trips.readBinary(in, _locations);
+		_vehicles.readBinary(in, _chargers);
+		_maintenances.readBinary(in, _locations, _vehicles);
+	}
+	catch (const DataError&)
+	{
+		clear();
+		return false;
+	}
+
+	return true;
+}
+
+void eva::DataInput::_writeInstanceCache(const std::string& fileName, const uint64_t& instanceKey) const
+{
+	BinaryWriter out;
+	if (instanceKey == 0 || !out.open(fileName))
+		return;
+
+	out.write<uint64_t>(InstanceCache::MAGIC);
+	out.write<uint32_t>(InstanceCache::VERSION);
+	out.write<uint64_t>(instanceKey);
+
+	_locations.writeBinary(out);
+	_chargers.writeBinary(out);
+	_trips.writeBinary(out);
+	_vehicles.writeBinary(out);
+	_maintenances.writeBinary(out);
+
+	if (!out.commit())
+		std::cout << "...could not write the instance cache " << fileName << "." << std::endl;
+}
+
+void eva::DataInput::_initialiseChargerTravel()
+{
+	std::vector<Types::Index> vecChargerLocationIndexes;
+	for (const Charger& charger : _chargers.get_vec())
+		vecChargerLocationIndexes.push_back(charger.get_location().get_index());
+
+	_locations.initialiseChargerTravel(vecChargerLocationIndexes);
+}
+
 void eva::DataInput::initialiseFromCsv(const Types::CommandInput& commandInput)
 {
 	std::cout << "Reading Data: " << std::endl;
@@ -28,36 +93,75 @@ void eva::DataInput::initialiseFromCsv(const Types::CommandInput& commandInput)
 	std::cout << " - " << "[Date] End: " << Helper::DateTimeToString(_config.get_date_end()) << std::endl;
 	std::cout << std::endl;
 
+	// If the csv files and the config dates did not change since the last run, read the instance cache instead:
+	const std::string cache_file_name = path_to_data_files + "instance.evacache";
+	uint64_t instanceKey = 0;
+	if (_config.get_flag_instance_cache())
+	{
+		instanceKey = InstanceCache::hash({
+			path_to_data_files + "locations.csv",
+			path_to_data_files + "locations_distances.csv",
+			path_to_data_files + "chargers.csv",
+			path_to_data_files + "trips.csv",
+			path_to_data_files + "vehicles.csv",
+			path_to_data_files + "maintenances.csv" }, _config);
+
+		if (_readInstanceCache(cache_file_name, instanceKey))
+		{
+			_initialiseChargerTravel();
+
+			std::cout << "...read instance cache:" << std::endl;
+			std::cout << "...read " << _locations.get_vec().size() << " locations." << std::endl;
+			std::cout << "...read " << _chargers.get_vec().size() << " chargers." << std::endl;
+			std::cout << "...read " << _trips.get_vec().size() << " trips." << std::endl;
+			std::cout << "...read " << _vehicles.get_vec().size() << " vehicles." << std::endl;
+			std::cout << "...read " << _maintenances.get_vec().size() << " maintenances." << std::endl;
+			std::cout << std::endl;
+			return;
+		}
+	}
+
 	// Read locations
 	file_name = path_to_data_files + "locations.csv";
 	_locations.read(file_name);
 	std::cout << "...read " << _locations.get_vec().size() << " locations." << std::endl;
 
-	// Read distances, durations, and battery consumptions
-	file_name = path_to_data_files + "locations_distances.csv";
-	_locations.readTravel(file_name);
-	std::cout << "...read " << " location_distances." << std::endl;
+	// All other files only reference the locations, and apart from the chain chargers -> vehicles -> maintenances,
+	// they are independent of each other. Hence, read the distances and the trips alongside that chain:
+	std::future<void> futureTravel = std::async(std::launch::async, [this, &path_to_data_files]() {
+		_locations.readTravel(path_to_data_files + "locations_distances.csv");
+	});
+	std::future<void> futureTrips = std::async(std::launch::async, [this, &path_to_data_files]() {
+		_trips.read(path_to_data_files + "trips.csv", _locations, _config);
+	});
 
 	// Read chargers
 	file_name = path_to_data_files + "chargers.csv";
 	_chargers.read(file_name, _locations);
-	std::cout << "...read " << _chargers.get_vec().size() << " chargers." << std::endl;
-
-	// Read trips
-	file_name = path_to_data_files + "trips.csv";
-	_trips.read(file_name, _locations, _config);
-	std::cout << "...read " << _trips.get_vec().size() << " trips." << std::endl;
 
 	// Read vehicles
 	file_name = path_to_data_files + "vehicles.csv";
 	_vehicles.read(file_name, _chargers);
-	std::cout << "...read " << _vehicles.get_vec().size() << " vehicles." << std::endl;
 
 	// Read maintenance
 	file_name = path_to_data_files + "maintenances.csv";
 	_maintenances.read(file_name, _locations, _config, _vehicles);
+
+	// Rethrows any exception raised while reading:
+	futureTravel.get();
+	futureTrips.get();
+
+	_initialiseChargerTravel();
+
+	std::cout << "...read " << " location_distances." << std::endl;
+	std::cout << "...read " << _chargers.get_vec().size() << " chargers." << std::endl;
+	std::cout << "...read " << _trips.get_vec().size() << " trips." << std::endl;
+	std::cout << "...read " << _vehicles.get_vec().size() << " vehicles." << std::endl;
 	std::cout << "...read " << _maintenances.get_vec().size() << " maintenances." << std::endl;
 
+	if (_config.get_flag_instance_cache())
+		_writeInstanceCache(cache_file_name, instanceKey);
+
 	// Output Summary:
 	std::cout << std::endl;
 }
@@ -2,12 +2,19 @@
 
 
 
-#include <iostream>
-#include <sstream>
-#include <fstream>
+#include "incl/dataInput/csvReader.h"
+#include "incl/dataInput/instanceCache.h"
 
 #include "evaExceptions.h"
 
+void eva::Chargers::_initialiseMapId()
+{
+	// Initialise the map to store the id<>index reference:
+	_mapId.reserve(_vec.size());
+	for (Types::Index index = 0; index < _vec.size(); index++)
+		_mapId.insert({ _vec[index].get_id(), index });
+}
+
 const eva::Charger& eva::Chargers::get_chargerFromId(const uint32_t& id) const
 {
 	auto it = _mapId.find(id);
@@ -21,14 +28,10 @@ void eva::Chargers::read(const std::string& fileName, const Locations& locations
 {
 	// Open the file and check for success
 	// ----------------------------------------------------------------------------------------------
-	std::ifstream in(fileName.c_str(), std::ios::in);
-	if (!in)
+	CsvReader in;
+	if (!in.open(fileName))
 		throw FileError("eva::Chargers::read", "File \"" + fileName + "\" does not exist!!!");
 
-	// Definitions
-	bool first_line = true;
-	std::string line, str;
-
 	// Columns:
 	Types::Index index;
 	uint32_t id;
@@ -38,71 +41,36 @@ void eva::Chargers::read(const std::string& fileName, const Locations& locations
 	Types::BatteryCharge chargingSpeedAmps;
 
 	// ----------------------------------------------------------------------------------------------
-	// Now, go over all lines in the file and read the chargers.
+	// Now, go over all rows in the file and read the chargers.
 	// ----------------------------------------------------------------------------------------------
-	while (std::getline(in, line)) {
-		// Remove carriage return symbol:
-		auto pos = line.find_first_of("\r\n");
-		if (pos != std::string::npos)
-			line.erase(pos);
-
-		// Stop if we have reached the end of file
-		if (in.eof())
-			break;
-
-		// If this is the first line, then we may have a "sep=," command.
-		// If so, then skip the line.
-		if (first_line) {
-			first_line = false;
-			if (line.find("sep") != std::string::npos) {
-				continue;
-			}
-		}
-
-		// Check if this is the header. If so, then skip the line.
-		if (line.find("Id") != std::string::npos)
-			continue;
-
-		// Check for comment
-		if (line.find_first_of('#') != std::string::npos) {
-			first_line = false; continue;
-		}
-
-		// Convert the line into a stringstream for easier access
-		std::stringstream lineStream(line);
-
+	while (in.next_row()) {
 		// Index:
 		index = _vec.size();
 
 		// Id:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(0).empty())
 			throw DataError("eva::Chargers::read", "Missing Id.");
-		id = atoi(str.c_str());
+		id = in.get_field(0).to_int();
 
 		// IdLocation:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(1).empty())
 			throw DataError("eva::Chargers::read", "Missing LocationId.");
-		locationId = atoi(str.c_str());
+		locationId = in.get_field(1).to_int();
 
 		// Capacity:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(2).empty())
 			throw DataError("eva::Chargers::read", "Missing Capacity.");
-		capacity = atoi(str.c_str());
+		capacity = in.get_field(2).to_int();
 
 		// chargingSpeedVolts:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(3).empty())
 			throw DataError("eva::Chargers::read", "Missing ChargingSpeedVolts.");
-		chargingSpeedVolts = atoi(str.c_str());
+		chargingSpeedVolts = in.get_field(3).to_int();
 
 		// chargingSpeedAmps:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(4).empty())
 			throw DataError("eva::Chargers::read", "Missing ChargingSpeedAmps.");
-		chargingSpeedAmps = atoi(str.c_str());
+		chargingSpeedAmps = in.get_field(4).to_int();
 
 		// Push new location object to the vector:
 		_vec.push_back(
@@ -117,10 +85,46 @@ void eva::Chargers::read(const std::string& fileName, const Locations& locations
 		);
 	}
 
-	// Initialise the map to store the id<>index reference:
-	_mapId.reserve(_vec.size());
-	for (Types::Index index = 0; index < _vec.size(); index++)
-		_mapId.insert({ _vec[index].get_id(), index });
+	_initialiseMapId();
+}
+
+void eva::Chargers::readBinary(BinaryReader& in, const Locations& locations)
+{
+	const uint32_t size = in.read<uint32_t>();
+	for (Types::Index index = 0; index < size; index++)
+	{
+		const uint32_t id = in.read<uint32_t>();
+		const uint32_t locationId = in.read<uint32_t>();
+		const uint32_t capacity = in.read<uint32_t>();
+		const Types::BatteryCharge chargingSpeedVolts = in.read<Types::BatteryCharge>();
+		const Types::BatteryCharge chargingSpeedAmps = in.read<Types::BatteryCharge>();
+
+		_vec.push_back(
+			Charger(
+				index,
+				id,
+				locations.get_locationFromId(locationId),
+				capacity,
+				chargingSpeedVolts,
+				chargingSpeedAmps
+			)
+		);
+	}
+
+	_initialiseMapId();
+}
+
+void eva::Chargers::writeBinary(BinaryWriter& out) const
+{
+	out.write<uint32_t>(_vec.size());
+	for (const Charger& charger : _vec)
+	{
+		out.write<uint32_t>(charger.get_id());
+		out.write<uint32_t>(charger.get_location().get_id());
+		out.write<uint32_t>(charger.get_capacity());
+		out.write<Types::BatteryCharge>(charger.get_chargingSpeedVolts());
+		out.write<Types::BatteryCharge>(charger.get_chargingSpeedAmps());
+	}
 }
 
 void eva::Chargers::clear()
@@ -29,6 +29,7 @@ void eva::Config::_initialise(const std::map<std::string, double>& mapDoublePara
     this->_const_linear_optimality_gap = mapDoubleParams.find("const_linear_optimality_gap") != mapDoubleParams.end() ? mapDoubleParams.at("const_linear_optimality_gap") : this->_const_linear_optimality_gap;
     this->_const_integer_optimality_gap = mapDoubleParams.find("const_integer_optimality_gap") != mapDoubleParams.end() ? mapDoubleParams.at("const_integer_optimality_gap") : this->_const_integer_optimality_gap;
     this->_const_frac_threshold_trunc_cg = mapDoubleParams.find("const_frac_threshold_trunc_cg") != mapDoubleParams.end() ? mapDoubleParams.at("const_frac_threshold_trunc_cg") : this->_const_frac_threshold_trunc_cg;
+    this->_const_dual_smoothing_alpha = mapDoubleParams.find("const_dual_smoothing_alpha") != mapDoubleParams.end() ? mapDoubleParams.at("const_dual_smoothing_alpha") : this->_const_dual_smoothing_alpha;
     
     this->_const_put_vehicle_on_charge = mapUIntParams.find("const_put_vehicle_on_charge") != mapUIntParams.end() ? mapUIntParams.at("const_put_vehicle_on_charge") : this->_const_put_vehicle_on_charge;
     this->_const_take_vehicle_off_charge = mapUIntParams.find("const_take_vehicle_off_charge") != mapUIntParams.end() ? mapUIntParams.at("const_take_vehicle_off_charge") : this->_const_take_vehicle_off_charge;
@@ -45,12 +46,23 @@ void eva::Config::_initialise(const std::map<std::string, double>& mapDoublePara
     this->_const_max_number_second_tier_eval_strong_branching = mapUIntParams.find("const_max_number_second_tier_eval_strong_branching") != mapUIntParams.end() ? mapUIntParams.at("const_max_number_second_tier_eval_strong_branching") : this->_const_max_number_second_tier_eval_strong_branching;
     this->_const_nth_iter_solve_all = mapUIntParams.find("const_nth_iter_solve_all") != mapUIntParams.end() ? mapUIntParams.at("const_nth_iter_solve_all") : this->_const_nth_iter_solve_all;
     this->_const_nth_branching_node_dive = mapUIntParams.find("const_nth_branching_node_dive") != mapUIntParams.end() ? mapUIntParams.at("const_nth_branching_node_dive") : this->_const_nth_branching_node_dive;
+    this->_const_nth_iter_model_clean = mapUIntParams.find("const_nth_iter_model_clean") != mapUIntParams.end() ? mapUIntParams.at("const_nth_iter_model_clean") : this->_const_nth_iter_model_clean;
+    this->_const_del_consecutive_pos_rc = mapUIntParams.find("const_del_consecutive_pos_rc") != mapUIntParams.end() ? mapUIntParams.at("const_del_consecutive_pos_rc") : this->_const_del_consecutive_pos_rc;
     
     this->_flag_minimise_number_vehicles = mapBoolParams.find("flag_minimise_number_vehicles") != mapBoolParams.end() ? mapBoolParams.at("flag_minimise_number_vehicles") : this->_flag_minimise_number_vehicles;
     this->_flag_interim_solve_all_vehicles = mapBoolParams.find("flag_interim_solve_all_vehicles") != mapBoolParams.end() ? mapBoolParams.at("flag_interim_solve_all_vehicles") : this->_flag_interim_solve_all_vehicles;
     this->_flag_use_model_cleanup = mapBoolParams.find("flag_use_model_cleanup") != mapBoolParams.end() ? mapBoolParams.at("flag_use_model_cleanup") : this->_flag_use_model_cleanup;
     this->_flag_allow_deadlegs = mapBoolParams.find("flag_allow_deadlegs") != mapBoolParams.end() ? mapBoolParams.at("flag_allow_deadlegs") : this->_flag_allow_deadlegs;
     this->_flag_terminate_after_root = mapBoolParams.find("flag_terminate_after_root") != mapBoolParams.end() ? mapBoolParams.at("flag_terminate_after_root") : this->_flag_terminate_after_root;
+    this->_flag_incremental_reduced_graph = mapBoolParams.find("flag_incremental_reduced_graph") != mapBoolParams.end() ? mapBoolParams.at("flag_incremental_reduced_graph") : this->_flag_incremental_reduced_graph;
+    this->_flag_dual_stabilisation = mapBoolParams.find("flag_dual_stabilisation") != mapBoolParams.end() ? mapBoolParams.at("flag_dual_stabilisation") : this->_flag_dual_stabilisation;
+    this->_flag_parallel_strong_branching = mapBoolParams.find("flag_parallel_strong_branching") != mapBoolParams.end() ? mapBoolParams.at("flag_parallel_strong_branching") : this->_flag_parallel_strong_branching;
+    this->_flag_parallel_tree_search = mapBoolParams.find("flag_parallel_tree_search") != mapBoolParams.end() ? mapBoolParams.at("flag_parallel_tree_search") : this->_flag_parallel_tree_search;
+    this->_flag_horizon_warm_start = mapBoolParams.find("flag_horizon_warm_start") != mapBoolParams.end() ? mapBoolParams.at("flag_horizon_warm_start") : this->_flag_horizon_warm_start;
+    this->_flag_instance_cache = mapBoolParams.find("flag_instance_cache") != mapBoolParams.end() ? mapBoolParams.at("flag_instance_cache") : this->_flag_instance_cache;
+    this->_flag_tsn_charging_chains = mapBoolParams.find("flag_tsn_charging_chains") != mapBoolParams.end() ? mapBoolParams.at("flag_tsn_charging_chains") : this->_flag_tsn_charging_chains;
+    this->_flag_lagrangian_termination = mapBoolParams.find("flag_lagrangian_termination") != mapBoolParams.end() ? mapBoolParams.at("flag_lagrangian_termination") : this->_flag_lagrangian_termination;
+    this->_flag_adaptive_vehicle_selection = mapBoolParams.find("flag_adaptive_vehicle_selection") != mapBoolParams.end() ? mapBoolParams.at("flag_adaptive_vehicle_selection") : this->_flag_adaptive_vehicle_selection;
 
     this->_cost_deadleg_fix = mapDoubleParams.find("cost_deadleg_fix") != mapDoubleParams.end() ? mapDoubleParams.at("cost_deadleg_fix") : this->_cost_deadleg_fix;
     this->_cost_deadleg_per_km = mapDoubleParams.find("cost_deadleg_per_km") != mapDoubleParams.end() ? mapDoubleParams.at("cost_deadleg_per_km") : this->_cost_deadleg_per_km;
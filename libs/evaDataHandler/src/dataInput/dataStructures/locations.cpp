@@ -1,11 +1,23 @@
 #include "incl/dataInput/dataStructures/locations.h"
 
-#include <iostream>
-#include <sstream>
-#include <fstream>
+#include "incl/dataInput/csvReader.h"
+#include "incl/dataInput/instanceCache.h"
 
 #include "evaExceptions.h"
 
+void eva::Locations::_initialiseMapId()
+{
+	// Initialise the map to store the id<>index reference:
+	_mapId.reserve(_vec.size());
+	for (Types::Index index = 0; index < _vec.size(); index++)
+	{
+		_mapId.insert({ _vec[index].get_id(), index });
+		_vec[index].set_travelMatrix(&_travelMatrix);
+	}
+
+	_travelMatrix.initialise(_vec.size());
+}
+
 const eva::Location& eva::Locations::get_locationFromId(const uint32_t& id) const
 {
 	auto it = _mapId.find(id);
@@ -28,70 +40,33 @@ void eva::Locations::read(const std::string& fileName)
 {
 	// Open the file and check for success
 	// ----------------------------------------------------------------------------------------------
-	std::ifstream in(fileName.c_str(), std::ios::in);
-	if (!in)
+	CsvReader in;
+	if (!in.open(fileName))
 		throw FileError("eva::Locations::read","File \"" + fileName + "\" does not exist!!!");
 
-	// Definitions
-	bool first_line = true;
-	std::string line, str;
-
 	// Columns:
 	uint32_t id;
 	Location::LocationType type;
 	std::string name;
 
 	// ----------------------------------------------------------------------------------------------
-	// Now, go over all lines in the file and read the locations.
+	// Now, go over all rows in the file and read the locations.
 	// ----------------------------------------------------------------------------------------------
-	while (std::getline(in, line)) {
-		// Remove carriage return symbol:
-		auto pos = line.find_first_of("\r\n");
-		if (pos != std::string::npos)
-			line.erase(pos);
-
-		// Stop if we have reached the end of file
-		if (in.eof())
-			break;
-
-		// If this is the first line, then we may have a "sep=," command.
-		// If so, then skip the line.
-		if (first_line) {
-			first_line = false;
-			if (line.find("sep") != std::string::npos) {
-				continue;
-			}
-		}
-
-		// Check if this is the header. If so, then skip the line.
-		if (line.find("Id") != std::string::npos)
-			continue;
-
-		// Check for comment
-		if (line.find_first_of('#') != std::string::npos) {
-			first_line = false; continue;
-		}
-
-		// Convert the line into a stringstream for easier access
-		std::stringstream lineStream(line);
-
+	while (in.next_row()) {
 		// Id:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(0).empty())
 			throw DataError("eva::Locations::read","Missing Id.");
-		id = atoi(str.c_str());
+		id = in.get_field(0).to_int();
 
 		// Type:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(1).empty())
 			throw DataError("eva::Locations::read", "Missing Type.");
-		type = Location::string2type(str);
+		type = Location::string2type(in.get_field(1).str());
 
-		// Id:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		// Name:
+		if (in.get_field(2).empty())
 			throw DataError("eva::Locations::read", "Missing Name.");
-		name = str;
+		name = in.get_field(2).str();
 
 		// Push new location object to the vector:
 		_vec.push_back(
@@ -104,29 +79,17 @@ void eva::Locations::read(const std::string& fileName)
 		);
 	}
 
-	// Initialise the map to store the id<>index reference:
-	_mapId.reserve(_vec.size());
-	for (Types::Index index = 0; index < _vec.size(); index++)
-	{
-		_mapId.insert({ _vec[index].get_id(), index });
-		_vec[index].get_vecMeasures().resize(_vec.size());
-	}
-		
-
+	_initialiseMapId();
 }
 
 void eva::Locations::readTravel(const std::string& fileName)
 {
 	// Open the file and check for success
 	// ----------------------------------------------------------------------------------------------
-	std::ifstream in(fileName.c_str(), std::ios::in);
-	if (!in)
+	CsvReader in;
+	if (!in.open(fileName))
 		throw FileError("eva::Locations::readTravel", "File \"" + fileName + "\" does not exist!!!");
 
-	// Definitions
-	bool first_line = true;
-	std::string line, str;
-
 	// Columns:
 	uint32_t fromId;
 	uint32_t toId;
@@ -134,79 +97,85 @@ void eva::Locations::readTravel(const std::string& fileName)
 	uint32_t distance;
 
 	// ----------------------------------------------------------------------------------------------
-	// Now, go over all lines in the file and read the locations.
+	// Now, go over all rows in the file and read the locations.
 	// ----------------------------------------------------------------------------------------------
-	while (std::getline(in, line)) {
-		// Remove carriage return symbol:
-		auto pos = line.find_first_of("\r\n");
-		if (pos != std::string::npos)
-			line.erase(pos);
-
-		// Stop if we have reached the end of file
-		if (in.eof())
-			break;
-
-		// If this is the first line, then we may have a "sep=," command.
-		// If so, then skip the line.
-		if (first_line) {
-			first_line = false;
-			if (line.find("sep") != std::string::npos) {
-				continue;
-			}
-		}
-
-		// Check if this is the header. If so, then skip the line.
-		if (line.find("Id") != std::string::npos)
-			continue;
-
-		// Check for comment
-		if (line.find_first_of('#') != std::string::npos) {
-			first_line = false; continue;
-		}
-
-		// Convert the line into a stringstream for easier access
-		std::stringstream lineStream(line);
-
+	while (in.next_row()) {
 		// Extract the Id of the start location
 		// --------------------------------------------------------------------------------------------
-		getline(lineStream, str, ',');
-		if (str.length() < 1)
-			throw DataError("eva::Locations::readTravel", line + "\" has an empty start Id!\n");
-		fromId = atoi(str.c_str());
+		if (in.get_field(0).empty())
+			throw DataError("eva::Locations::readTravel", in.get_line() + "\" has an empty start Id!\n");
+		fromId = in.get_field(0).to_int();
 
 		// Extract the Id of the end location
 		// --------------------------------------------------------------------------------------------
-		getline(lineStream, str, ',');
-		if (str.length() < 1)
-			throw DataError("eva::Locations::readTravel", line + "\" has an empty end Id!\n");
-		toId = atoi(str.c_str());
+		if (in.get_field(1).empty())
+			throw DataError("eva::Locations::readTravel", in.get_line() + "\" has an empty end Id!\n");
+		toId = in.get_field(1).to_int();
 
 		// Extract the duration between start and end
 		// --------------------------------------------------------------------------------------------
-		getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(2).empty())
 			continue;
 		else
-			duration = (int64_t)(atof(str.c_str()));
+			duration = (int64_t)(in.get_field(2).to_double());
 
 		// Extract the distance between start and end
 		// --------------------------------------------------------------------------------------------
-		getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(3).empty())
 			continue;
 		else
-			distance = atof(str.c_str());	
+			distance = in.get_field(3).to_double();
 
 		// Get the location object, and add the measurement:
 		// Only add, if both, distance and duration are specified.
 		// Then, write code for function to access, or return non-exist.
-		this->get_locationFromId(fromId).get_vecMeasures()[this->get_locationFromId(toId).get_index()] = Location::Measures(distance,duration);
+		_travelMatrix.set(this->get_locationFromId(fromId).get_index(), this->get_locationFromId(toId).get_index(), distance, duration);
+	}
+
+}
+
+void eva::Locations::readBinary(BinaryReader& in)
+{
+	// Locations, followed by the travel measures of all pairs of locations:
+	const uint32_t size = in.read<uint32_t>();
+	for (Types::Index index = 0; index < size; index++)
+	{
+		const uint32_t id = in.read<uint32_t>();
+		const Location::LocationType type = in.read<Location::LocationType>();
+		const std::string name = in.read_string();
+		_vec.push_back(Location(index, id, type, name));
+	}
+
+	_initialiseMapId();
+
+	for (Types::Index from = 0; from < _vec.size(); from++)
+	{
+		for (Types::Index to = 0; to < _vec.size(); to++)
+		{
+			const Location::Measures measures = in.read<Location::Measures>();
+			_travelMatrix.set(from, to, measures.distance, measures.duration);
+		}
+	}
+}
+
+void eva::Locations::writeBinary(BinaryWriter& out) const
+{
+	out.write<uint32_t>(_vec.size());
+	for (const Location& location : _vec)
+	{
+		out.write<uint32_t>(location.get_id());
+		out.write<Location::LocationType>(location.get_type());
+		out.write_string(location.get_name());
 	}
 
+	for (Types::Index from = 0; from < _vec.size(); from++)
+		for (Types::Index to = 0; to < _vec.size(); to++)
+			out.write<Location::Measures>(Location::Measures(_travelMatrix.get_distance(from, to), _travelMatrix.get_duration(from, to)));
 }
 
 void eva::Locations::clear()
 {
 	_vec.clear();
 	_mapId.clear();
+	_travelMatrix.clear();
 }
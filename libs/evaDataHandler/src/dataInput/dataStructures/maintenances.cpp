@@ -1,10 +1,26 @@
 #include "incl/dataInput/dataStructures/maintenances.h"
 
+#include "incl/dataInput/csvReader.h"
+#include "incl/dataInput/instanceCache.h"
+
 #include "evaExceptions.h"
 
-#include <iostream>
-#include <sstream>
-#include <fstream>
+void eva::Maintenances::_initialiseMapId(const Vehicles& vehicles)
+{
+	// Initialise the map to store the id<>index reference:
+	_mapId.reserve(_vec.size());
+	_vecVehicleMaintenances.resize(vehicles.get_vec().size());
+
+	for (Types::Index index = 0; index < _vec.size(); index++)
+	{
+		_mapId.insert({ _vec[index].get_id(), index });
+		
+		if(_vec[index].is_assigned())
+			_vecVehicleMaintenances[_vec[index].get_indexVehicle()].push_back(index);
+		else
+			_vecUnassignedMaintenances.push_back(index);
+	}
+}
 
 const eva::Maintenance& eva::Maintenances::get_maintenanceFromId(const uint32_t& id) const
 {
@@ -19,14 +35,10 @@ void eva::Maintenances::read(const std::string& fileName, const Locations& locat
 {
 	// Open the file and check for success
 	// ----------------------------------------------------------------------------------------------
-	std::ifstream in(fileName.c_str(), std::ios::in);
-	if (!in)
+	CsvReader in;
+	if (!in.open(fileName))
 		throw FileError("eva::Maintenances::read", "File \"" + fileName + "\" does not exist!!!");
 
-	// Definitions
-	bool first_line = true;
-	std::string line, str;
-
 	// Columns:
 	uint32_t id;
 	Types::DateTime startTime;
@@ -35,69 +47,34 @@ void eva::Maintenances::read(const std::string& fileName, const Locations& locat
 	Types::Index indexVehicle;
 
 	// ----------------------------------------------------------------------------------------------
-	// Now, go over all lines in the file and read the maintenances.
+	// Now, go over all rows in the file and read the maintenances.
 	// ----------------------------------------------------------------------------------------------
-	while (std::getline(in, line)) {
-		// Remove carriage return symbol:
-		auto pos = line.find_first_of("\r\n");
-		if (pos != std::string::npos)
-			line.erase(pos);
-
-		// Stop if we have reached the end of file
-		if (in.eof())
-			break;
-
-		// If this is the first line, then we may have a "sep=," command.
-		// If so, then skip the line.
-		if (first_line) {
-			first_line = false;
-			if (line.find("sep") != std::string::npos) {
-				continue;
-			}
-		}
-
-		// Check if this is the header. If so, then skip the line.
-		if (line.find("Id") != std::string::npos)
-			continue;
-
-		// Check for comment
-		if (line.find_first_of('#') != std::string::npos) {
-			first_line = false; continue;
-		}
-
-		// Convert the line into a stringstream for easier access
-		std::stringstream lineStream(line);
-
+	while (in.next_row()) {
 		// Id:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(0).empty())
 			throw DataError("eva::Maintenances::read", "Missing Id.");
-		id = atoi(str.c_str());
+		id = in.get_field(0).to_int();
 
 		// startTime:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(1).empty())
 			throw DataError("eva::Maintenances::read", "Missing startTime.");
-		startTime = Helper::StringToDateTime(str);
+		startTime = in.get_field(1).to_dateTime();
 
 		// endTime:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(2).empty())
 			throw DataError("eva::Maintenances::read", "Missing endTime.");
-		endTime = Helper::StringToDateTime(str);
+		endTime = in.get_field(2).to_dateTime();
 
 		// maintenanceLocationId:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(3).empty())
 			throw DataError("eva::Maintenances::read", "Missing maintenanceLocationId.");
-		maintenanceLocationId = atoi(str.c_str());
+		maintenanceLocationId = in.get_field(3).to_int();
 
 		// vehicleId:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(4).empty())
 			indexVehicle = Constants::BIG_INDEX;
 		else
-			indexVehicle = vehicles.get_vehicleFromId(atoi(str.c_str())).get_index();
+			indexVehicle = vehicles.get_vehicleFromId(in.get_field(4).to_int()).get_index();
 
 		// All data extracted, add maintenance to the list
 		// Only add the maintenance if it is relevant to this optimisation run,
@@ -118,18 +95,48 @@ void eva::Maintenances::read(const std::string& fileName, const Locations& locat
 		}
 	}
 
-	// Initialise the map to store the id<>index reference:
-	_mapId.reserve(_vec.size());
-	_vecVehicleMaintenances.resize(vehicles.get_vec().size());
+	_initialiseMapId(vehicles);
+}
 
-	for (Types::Index index = 0; index < _vec.size(); index++)
+void eva::Maintenances::readBinary(BinaryReader& in, const Locations& locations, const Vehicles& vehicles)
+{
+	// The maintenances have already been filtered by the dates of the config when the binary file was written:
+	const uint32_t size = in.read<uint32_t>();
+	for (Types::Index index = 0; index < size; index++)
 	{
-		_mapId.insert({ _vec[index].get_id(), index });
-		
-		if(_vec[index].is_assigned())
-			_vecVehicleMaintenances[_vec[index].get_indexVehicle()].push_back(index);
-		else
-			_vecUnassignedMaintenances.push_back(index);
+		const uint32_t id = in.read<uint32_t>();
+		const Types::DateTime startTime = in.read<Types::DateTime>();
+		const Types::DateTime endTime = in.read<Types::DateTime>();
+		const uint32_t maintenanceLocationId = in.read<uint32_t>();
+		const Types::Index indexVehicle = in.read<Types::Index>();
+
+		if (indexVehicle != Constants::BIG_INDEX && indexVehicle >= vehicles.get_vec().size())
+			throw DataError("eva::Maintenances::readBinary", "Vehicle index out of range.");
+
+		_vec.push_back(
+			Maintenance(
+				id,
+				startTime,
+				endTime,
+				locations.get_locationFromId(maintenanceLocationId),
+				indexVehicle
+			)
+		);
+	}
+
+	_initialiseMapId(vehicles);
+}
+
+void eva::Maintenances::writeBinary(BinaryWriter& out) const
+{
+	out.write<uint32_t>(_vec.size());
+	for (const Maintenance& maintenance : _vec)
+	{
+		out.write<uint32_t>(maintenance.get_id());
+		out.write<Types::DateTime>(maintenance.get_startTime());
+		out.write<Types::DateTime>(maintenance.get_endTime());
+		out.write<uint32_t>(maintenance.get_maintenanceLocation().get_id());
+		out.write<Types::Index>(maintenance.get_indexVehicle());
 	}
 }
 
@@ -0,0 +1,58 @@
+#include "incl/dataInput/dataStructures/travelMatrix.h"
+
+void eva::TravelMatrix::initialise(const uint32_t& nrLocations)
+{
+	// Pad every row to a multiple of the cache line:
+	const uint32_t valuesPerCacheLine = CACHE_LINE_SIZE / sizeof(uint32_t);
+
+	_nrLocations = nrLocations;
+	_rowStride = ((nrLocations + valuesPerCacheLine - 1) / valuesPerCacheLine) * valuesPerCacheLine;
+	_vecDistances.assign(size_t(_nrLocations) * _rowStride, Constants::BIG_UINTEGER);
+	_vecDurations.assign(size_t(_nrLocations) * _rowStride, Constants::BIG_UINTEGER);
+}
+
+void eva::TravelMatrix::initialiseChargers(const std::vector<Types::Index>& vecChargerLocationIndexes)
+{
+	_nrChargers = vecChargerLocationIndexes.size();
+	_vecDistancesToChargers.assign(size_t(_nrLocations) * _nrChargers, Constants::BIG_UINTEGER);
+	_vecDurationsToChargers.assign(size_t(_nrLocations) * _nrChargers, Constants::BIG_UINTEGER);
+	_vecDistancesFromChargers.assign(size_t(_nrLocations) * _nrChargers, Constants::BIG_UINTEGER);
+	_vecDurationsFromChargers.assign(size_t(_nrLocations) * _nrChargers, Constants::BIG_UINTEGER);
+	_vecNearestCharger.assign(_nrLocations, Constants::BIG_INDEX);
+
+	for (Types::Index location = 0; location < _nrLocations; ++location)
+	{
+		uint32_t nearestDistance = Constants::BIG_UINTEGER;
+		for (Types::Index charger = 0; charger < _nrChargers; ++charger)
+		{
+			const Types::Index& chargerLocation = vecChargerLocationIndexes[charger];
+			const size_t pos = size_t(location) * _nrChargers + charger;
+
+			_vecDistancesToChargers[pos] = get_distance(location, chargerLocation);
+			_vecDurationsToChargers[pos] = get_duration(location, chargerLocation);
+			_vecDistancesFromChargers[pos] = get_distance(chargerLocation, location);
+			_vecDurationsFromChargers[pos] = get_duration(chargerLocation, location);
+
+			if (_vecDistancesToChargers[pos] < nearestDistance)
+			{
+				nearestDistance = _vecDistancesToChargers[pos];
+				_vecNearestCharger[location] = charger;
+			}
+		}
+	}
+}
+
+void eva::TravelMatrix::clear()
+{
+	_nrLocations = 0;
+	_rowStride = 0;
+	_vecDistances.clear();
+	_vecDurations.clear();
+
+	_nrChargers = 0;
+	_vecDistancesToChargers.clear();
+	_vecDurationsToChargers.clear();
+	_vecDistancesFromChargers.clear();
+	_vecDurationsFromChargers.clear();
+	_vecNearestCharger.clear();
+}
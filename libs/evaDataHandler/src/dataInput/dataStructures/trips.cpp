@@ -1,11 +1,18 @@
 #include "incl/dataInput/dataStructures/trips.h"
 
-#include <iostream>
-#include <sstream>
-#include <fstream>
+#include "incl/dataInput/csvReader.h"
+#include "incl/dataInput/instanceCache.h"
 
 #include "evaExceptions.h"
 
+void eva::Trips::_initialiseMapId()
+{
+	// Initialise the map to store the id<>index reference:
+	_mapId.reserve(_vec.size());
+	for (Types::Index index = 0; index < _vec.size(); index++)
+		_mapId.insert({ _vec[index].get_id(), index });
+}
+
 const eva::Trip& eva::Trips::get_tripFromId(const uint32_t& id) const
 {
 	auto it = _mapId.find(id);
@@ -19,14 +26,10 @@ void eva::Trips::read(const std::string& fileName, const Locations& locations, c
 {
 	// Open the file and check for success
 	// ----------------------------------------------------------------------------------------------
-	std::ifstream in(fileName.c_str(), std::ios::in);
-	if (!in)
+	CsvReader in;
+	if (!in.open(fileName))
 		throw FileError("eva::Trips::read", "File \"" + fileName + "\" does not exist!!!");
 
-	// Definitions
-	bool first_line = true;
-	std::string line, str;
-
 	// Columns:
 	uint32_t id;
 	Types::DateTime startTime;
@@ -36,74 +39,39 @@ void eva::Trips::read(const std::string& fileName, const Locations& locations, c
 	uint32_t lineId;
 
 	// ----------------------------------------------------------------------------------------------
-	// Now, go over all lines in the file and read the trips.
+	// Now, go over all rows in the file and read the trips.
 	// ----------------------------------------------------------------------------------------------
-	while (std::getline(in, line)) {
-		// Remove carriage return symbol:
-		auto pos = line.find_first_of("\r\n");
-		if (pos != std::string::npos)
-			line.erase(pos);
-
-		// Stop if we have reached the end of file
-		if (in.eof())
-			break;
-
-		// If this is the first line, then we may have a "sep=," command.
-		// If so, then skip the line.
-		if (first_line) {
-			first_line = false;
-			if (line.find("sep") != std::string::npos) {
-				continue;
-			}
-		}
-
-		// Check if this is the header. If so, then skip the line.
-		if (line.find("Id") != std::string::npos)
-			continue;
-
-		// Check for comment
-		if (line.find_first_of('#') != std::string::npos) {
-			first_line = false; continue;
-		}
-
-		// Convert the line into a stringstream for easier access
-		std::stringstream lineStream(line);
-
+	while (in.next_row()) {
 		// Id:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(0).empty())
 			throw DataError("eva::Trips::read", "Missing Id.");
-		id = atoi(str.c_str());
+		id = in.get_field(0).to_int();
 
 		// startTime:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(1).empty())
 			throw DataError("eva::Trips::read", "Missing startTime.");
-		startTime = Helper::StringToDateTime(str);
+		startTime = in.get_field(1).to_dateTime();
 
 		// endTime:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(2).empty())
 			throw DataError("eva::Trips::read", "Missing endTime.");
-		endTime = Helper::StringToDateTime(str);
+		endTime = in.get_field(2).to_dateTime();
 
 		// startLocationId:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(3).empty())
 			throw DataError("eva::Trips::read", "Missing startLocationId.");
-		startLocationId = atoi(str.c_str());
+		startLocationId = in.get_field(3).to_int();
 
 		// endLocationId:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(4).empty())
 			throw DataError("eva::Trips::read", "Missing endLocationId.");
-		endLocationId = atoi(str.c_str());
+		endLocationId = in.get_field(4).to_int();
 
-		// lineId
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
-			throw DataError("eva::Trips::read", "Missing lineId.");
-		lineId = atoi(str.c_str());
+		// lineId: Optional, the column is not part of every data set.
+		if (in.get_field(5).empty())
+			lineId = Constants::BIG_UINTEGER;
+		else
+			lineId = in.get_field(5).to_int();
 
 		// All data extracted, add trip to the list
 		// Only add the trip if it is relevant to this optimisation run,
@@ -127,10 +95,49 @@ void eva::Trips::read(const std::string& fileName, const Locations& locations, c
 		
 	}
 
-	// Initialise the map to store the id<>index reference:
-	_mapId.reserve(_vec.size());
-	for (Types::Index index = 0; index < _vec.size(); index++)
-		_mapId.insert({ _vec[index].get_id(), index });
+	_initialiseMapId();
+}
+
+void eva::Trips::readBinary(BinaryReader& in, const Locations& locations)
+{
+	// The trips have already been filtered by the dates of the config when the binary file was written:
+	const uint32_t size = in.read<uint32_t>();
+	for (Types::Index index = 0; index < size; index++)
+	{
+		const uint32_t id = in.read<uint32_t>();
+		const Types::DateTime startTime = in.read<Types::DateTime>();
+		const Types::DateTime endTime = in.read<Types::DateTime>();
+		const uint32_t startLocationId = in.read<uint32_t>();
+		const uint32_t endLocationId = in.read<uint32_t>();
+		const uint32_t lineId = in.read<uint32_t>();
+
+		_vec.push_back(
+			Trip(
+				id,
+				startTime,
+				endTime,
+				locations.get_locationFromId(startLocationId),
+				locations.get_locationFromId(endLocationId),
+				lineId
+			)
+		);
+	}
+
+	_initialiseMapId();
+}
+
+void eva::Trips::writeBinary(BinaryWriter& out) const
+{
+	out.write<uint32_t>(_vec.size());
+	for (const Trip& trip : _vec)
+	{
+		out.write<uint32_t>(trip.get_id());
+		out.write<Types::DateTime>(trip.get_startTime());
+		out.write<Types::DateTime>(trip.get_endTime());
+		out.write<uint32_t>(trip.get_startLocation().get_id());
+		out.write<uint32_t>(trip.get_endLocation().get_id());
+		out.write<uint32_t>(trip.get_lineId());
+	}
 }
 
 void eva::Trips::clear()
@@ -1,11 +1,20 @@
 #include "incl/dataInput/dataStructures/vehicles.h"
 
-#include <iostream>
-#include <sstream>
-#include <fstream>
+#include "incl/dataInput/csvReader.h"
+#include "incl/dataInput/instanceCache.h"
+
+#include <cmath>
 
 #include "evaExceptions.h"
 
+void eva::Vehicles::_initialiseMapId()
+{
+	// Initialise the map to store the id<>index reference:
+	_mapId.reserve(_vec.size());
+	for (Types::Index index = 0; index < _vec.size(); index++)
+		_mapId.insert({ _vec[index].get_id(), index });
+}
+
 const eva::Vehicle& eva::Vehicles::get_vehicleFromId(const uint32_t& id) const
 {
 	auto it = _mapId.find(id);
@@ -20,14 +29,10 @@ void eva::Vehicles::read(const std::string& fileName, const Chargers& chargers)
 {
 	// Open the file and check for success
 	// ----------------------------------------------------------------------------------------------
-	std::ifstream in(fileName.c_str(), std::ios::in);
-	if (!in)
+	CsvReader in;
+	if (!in.open(fileName))
 		throw FileError("eva::Vehicles::read", "File \"" + fileName + "\" does not exist!!!");
 
-	// Definitions
-	bool first_line = true;
-	std::string line, str;
-
 	// Columns:
 	Types::Index index;
 	uint32_t id;
@@ -46,125 +51,81 @@ void eva::Vehicles::read(const std::string& fileName, const Chargers& chargers)
 	double kwh_per_km;
 
 	// ----------------------------------------------------------------------------------------------
-	// Now, go over all lines in the file and read the Vehicles.
+	// Now, go over all rows in the file and read the Vehicles.
 	// ----------------------------------------------------------------------------------------------
-	while (std::getline(in, line)) {
-		// Remove carriage return symbol:
-		auto pos = line.find_first_of("\r\n");
-		if (pos != std::string::npos)
-			line.erase(pos);
-
-		// Stop if we have reached the end of file
-		if (in.eof())
-			break;
-
-		// If this is the first line, then we may have a "sep=," command.
-		// If so, then skip the line.
-		if (first_line) {
-			first_line = false;
-			if (line.find("sep") != std::string::npos) {
-				continue;
-			}
-		}
-
-		// Check if this is the header. If so, then skip the line.
-		if (line.find("Id") != std::string::npos)
-			continue;
-
-		// Check for comment
-		if (line.find_first_of('#') != std::string::npos) {
-			first_line = false; continue;
-		}
-
-		// Convert the line into a stringstream for easier access
-		std::stringstream lineStream(line);
-
+	while (in.next_row()) {
 		// Index:
 		index = _vec.size();
 
 		// Id:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(0).empty())
 			throw DataError("eva::Vehicles::read", "Missing Id.");
-		id = atoi(str.c_str());
+		id = in.get_field(0).to_int();
 
 		// batteryMinKWh:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(1).empty())
 			throw DataError("eva::Vehicles::read", "Missing batteryMinKWh.");
-		batteryMinKWh = atof(str.c_str());
+		batteryMinKWh = in.get_field(1).to_double();
 
 		// batteryMaxKWh:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(2).empty())
 			throw DataError("eva::Vehicles::read", "Missing batteryMaxKWh.");
-		batteryMaxKWh = atof(str.c_str());
+		batteryMaxKWh = in.get_field(2).to_double();
 
 		// initialChargerId:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(3).empty())
 			throw DataError("eva::Vehicles::read", "Missing initialChargerId.");
-		initialChargerId = atoi(str.c_str());
+		initialChargerId = in.get_field(3).to_int();
 
 		// initialStartTime:
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(4).empty())
 			throw DataError("eva::Vehicles::read", "Missing initialStartTime.");
-		initialStartTime = Helper::StringToDateTime(str);
+		initialStartTime = in.get_field(4).to_dateTime();
 
 		// initialSOC
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(5).empty())
 			throw DataError("eva::Vehicles::read", "Missing initialSOC.");
-		initialSOC = atof(str.c_str());
+		initialSOC = in.get_field(5).to_double();
 
 		// chargingSpeedVolts
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(6).empty())
 			throw DataError("eva::Vehicles::read", "Missing chargingSpeedVolts.");
-		chargingSpeedVolts = atof(str.c_str());
+		chargingSpeedVolts = in.get_field(6).to_double();
 
 		// chargingSpeedAmps
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(7).empty())
 			throw DataError("eva::Vehicles::read", "Missing chargingSpeedAmps.");
-		chargingSpeedAmps = atof(str.c_str());
+		chargingSpeedAmps = in.get_field(7).to_double();
 
 		// numberPlate
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(8).empty())
 			throw DataError("eva::Vehicles::read", "Missing numberPlate.");
-		numberPlate = str;
+		numberPlate = in.get_field(8).str();
 
 		// odometerReading
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(9).empty())
 			throw DataError("eva::Vehicles::read", "Missing odometerReading.");
-		odometerReading = atoi(str.c_str());
+		odometerReading = in.get_field(9).to_int();
 
 		// odometerLastMaintenance
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(10).empty())
 			throw DataError("eva::Vehicles::read", "Missing odometerLastMaintenance.");
-		odometerLastMaintenance = atoi(str.c_str());
+		odometerLastMaintenance = in.get_field(10).to_int();
 
 		// inRotation
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(11).empty())
 			throw DataError("eva::Vehicles::read", "Missing inRotation.");
-		inRotation = Helper::stringToBoolean(str);
+		inRotation = Helper::stringToBoolean(in.get_field(11).str());
 
 		// cost
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(12).empty())
 			throw DataError("eva::Vehicles::read", "Missing Cost.");
-		cost = atof(str.c_str());
+		cost = in.get_field(12).to_double();
 
 		// kwh_per_km
-		std::getline(lineStream, str, ',');
-		if (str.length() < 1)
+		if (in.get_field(13).empty())
 			throw DataError("eva::Vehicles::read", "Missing Kwh_per_km.");
-		kwh_per_km = atof(str.c_str());
+		kwh_per_km = in.get_field(13).to_double();
 
 		// Push new trip object to the vector:
 		_vec.push_back(
@@ -188,10 +149,73 @@ void eva::Vehicles::read(const std::string& fileName, const Chargers& chargers)
 		);
 	}
 
-	// Initialise the map to store the id<>index reference:
-	_mapId.reserve(_vec.size());
-	for (Types::Index index = 0; index < _vec.size(); index++)
-		_mapId.insert({ _vec[index].get_id(), index });
+	_initialiseMapId();
+}
+
+void eva::Vehicles::readBinary(BinaryReader& in, const Chargers& chargers)
+{
+	const uint32_t size = in.read<uint32_t>();
+	for (Types::Index index = 0; index < size; index++)
+	{
+		const uint32_t id = in.read<uint32_t>();
+		const Types::BatteryCharge batteryMinKWh = in.read<Types::BatteryCharge>();
+		const Types::BatteryCharge batteryMaxKWh = in.read<Types::BatteryCharge>();
+		const uint32_t initialChargerId = in.read<uint32_t>();
+		const Types::DateTime initialStartTime = in.read<Types::DateTime>();
+		const Types::BatteryCharge initialSOC = in.read<Types::BatteryCharge>();
+		const Types::BatteryCharge chargingSpeedVolts = in.read<Types::BatteryCharge>();
+		const Types::BatteryCharge chargingSpeedAmps = in.read<Types::BatteryCharge>();
+		const std::string numberPlate = in.read_string();
+		const uint32_t odometerReading = in.read<uint32_t>();
+		const uint32_t odometerLastMaintenance = in.read<uint32_t>();
+		const bool inRotation = in.read<bool>();
+		const double cost = in.read<double>();
+		const Types::BatteryCharge kwhPerThousandKm = in.read<Types::BatteryCharge>();
+
+		_vec.push_back(
+			Vehicle(
+				index,
+				id,
+				batteryMinKWh,
+				batteryMaxKWh,
+				chargers.get_chargerFromId(initialChargerId),
+				initialStartTime,
+				initialSOC,
+				chargingSpeedVolts,
+				chargingSpeedAmps,
+				numberPlate,
+				odometerReading,
+				odometerLastMaintenance,
+				inRotation,
+				cost,
+				kwhPerThousandKm
+			)
+		);
+	}
+
+	_initialiseMapId();
+}
+
+void eva::Vehicles::writeBinary(BinaryWriter& out) const
+{
+	out.write<uint32_t>(_vec.size());
+	for (const Vehicle& vehicle : _vec)
+	{
+		out.write<uint32_t>(vehicle.get_id());
+		out.write<Types::BatteryCharge>(vehicle.get_batteryMinKWh());
+		out.write<Types::BatteryCharge>(vehicle.get_batteryMaxKWh());
+		out.write<uint32_t>(vehicle.get_initialCharger().get_id());
+		out.write<Types::DateTime>(vehicle.get_initialStartTime());
+		out.write<Types::BatteryCharge>(vehicle.get_initialSOC());
+		out.write<Types::BatteryCharge>(vehicle.get_chargingSpeedVolts());
+		out.write<Types::BatteryCharge>(vehicle.get_chargingSpeedAmps());
+		out.write_string(vehicle.get_numberPlate());
+		out.write<uint32_t>(vehicle.get_odometerReading());
+		out.write<uint32_t>(vehicle.get_odometerLastMaintenance());
+		out.write<bool>(vehicle.get_inRotation());
+		out.write<double>(vehicle.get_cost());
+		out.write<Types::BatteryCharge>(vehicle.get_kwhPerThousandKm());
+	}
 }
 
 void eva::Vehicles::clear()
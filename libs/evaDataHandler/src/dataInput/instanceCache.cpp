@@ -0,0 +1,113 @@
+#include "incl/dataInput/instanceCache.h"
+
+#include "evaExceptions.h"
+
+#include <cstdio>
+#include <unistd.h>
+
+const uint64_t eva::InstanceCache::MAGIC = 0x4548434143415645; // "EVACACHE"
+const uint32_t eva::InstanceCache::VERSION = 1;
+
+namespace
+{
+	// 64-bit FNV-1a:
+	const uint64_t FNV_OFFSET = 14695981039346656037ULL;
+	const uint64_t FNV_PRIME = 1099511628211ULL;
+
+	inline uint64_t fnv1a(uint64_t hash, const char* data, const size_t& size)
+	{
+		for (size_t pos = 0; pos < size; ++pos)
+		{
+			hash ^= static_cast<unsigned char>(data[pos]);
+			hash *= FNV_PRIME;
+		}
+		return hash;
+	};
+
+	template <class T> inline uint64_t fnv1a(const uint64_t& hash, const T& value)
+	{
+		return fnv1a(hash, reinterpret_cast<const char*>(&value), sizeof(T));
+	};
+}
+
+eva::BinaryWriter::~BinaryWriter()
+{
+	// Remove the temporary file, if the writer was not committed:
+	if (_out.is_open())
+	{
+		_out.close();
+		std::remove(_tmpFileName.c_str());
+	}
+}
+
+bool eva::BinaryWriter::open(const std::string& fileName)
+{
+	_fileName = fileName;
+	_tmpFileName = fileName + ".tmp." + std::to_string(getpid());
+	_out.open(_tmpFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+	return _out.is_open();
+}
+
+bool eva::BinaryWriter::commit()
+{
+	_out.close();
+	if (!_out || std::rename(_tmpFileName.c_str(), _fileName.c_str()) != 0)
+	{
+		std::remove(_tmpFileName.c_str());
+		return false;
+	}
+	return true;
+}
+
+void eva::BinaryWriter::write_string(const std::string& str)
+{
+	write<uint32_t>(str.size());
+	_out.write(str.data(), str.size());
+}
+
+void eva::BinaryReader::_require(const size_t& size) const
+{
+	if (size_t(_end - _cursor) < size)
+		throw DataError("eva::BinaryReader::read", "Unexpected end of the binary file.");
+}
+
+bool eva::BinaryReader::open(const std::string& fileName)
+{
+	if (!_file.open(fileName))
+		return false;
+
+	_cursor = _file.get_data();
+	_end = _file.get_data() + _file.get_size();
+	return true;
+}
+
+std::string eva::BinaryReader::read_string()
+{
+	const uint32_t size = read<uint32_t>();
+	_require(size);
+	std::string str(_cursor, size);
+	_cursor += size;
+	return str;
+}
+
+const uint64_t eva::InstanceCache::hash(const std::vector<std::string>& vecFileNames, const Config& config)
+{
+	uint64_t hash = FNV_OFFSET;
+	hash = fnv1a(hash, VERSION);
+
+	for (const std::string& fileName : vecFileNames)
+	{
+		MappedFile file;
+		if (!file.open(fileName))
+			return 0;
+
+		hash = fnv1a(hash, file.get_size());
+		hash = fnv1a(hash, file.get_data(), file.get_size());
+	}
+
+	// Trips and maintenances are only read within the dates of the config:
+	hash = fnv1a(hash, config.get_date_start());
+	hash = fnv1a(hash, config.get_date_end());
+
+	return hash;
+}
@@ -0,0 +1,51 @@
+#include "incl/dataInput/mappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool eva::MappedFile::open(const std::string& fileName)
+{
+	close();
+
+	_fileDescriptor = ::open(fileName.c_str(), O_RDONLY);
+	if (_fileDescriptor < 0)
+		return false;
+
+	struct stat fileStat;
+	if (fstat(_fileDescriptor, &fileStat) != 0)
+	{
+		close();
+		return false;
+	}
+
+	// An empty file cannot be mapped, but is a valid file without any data:
+	_size = fileStat.st_size;
+	if (_size > 0)
+	{
+		void* ptrMap = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _fileDescriptor, 0);
+		if (ptrMap == MAP_FAILED)
+		{
+			close();
+			return false;
+		}
+		madvise(ptrMap, _size, MADV_SEQUENTIAL);
+		_data = static_cast<const char*>(ptrMap);
+	}
+
+	return true;
+}
+
+void eva::MappedFile::close()
+{
+	if (_data != nullptr)
+		munmap(const_cast<char*>(_data), _size);
+
+	if (_fileDescriptor >= 0)
+		::close(_fileDescriptor);
+
+	_fileDescriptor = -1;
+	_data = nullptr;
+	_size = 0;
+}
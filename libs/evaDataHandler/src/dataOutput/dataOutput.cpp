@@ -97,7 +97,7 @@ void eva::DataOutput::writeStatsPerformanceDetail(const DataInput& input, const
 {
 	std::ofstream fout;
 	fout.open(input.get_config().get_path_to_output() + "StatsPerformanceDetail.csv", std::ofstream::out | std::ofstream::trunc);
-	fout << "IndexPlanningHorizon,IndexBranchingNode,Iteration,LBfrac,UBfrac,GAPfrac,IntFound,LBint,UBint,GAPint,MSecondsMP,MSecondsPP,MSecondsAUXCG,MSecondsStrongBranching,MPSizeConstraints,MPSizeVariables,ColumnsAdded,PPNetworkConstructionTime,PPNetworkSizeNodes,PPNetworkSizeArcs,LazyConstraintAdded,BranchType,IndexParentBranchingNode,MSecondsFilterMPVars,MSecondsFilterPPNodes,VehicleID,TripID,MaintenanceID,FracValue,BranchValue" << "\n";
+	fout << "IndexPlanningHorizon,IndexBranchingNode,Iteration,LBfrac,UBfrac,GAPfrac,IntFound,LBint,UBint,GAPint,MSecondsMP,MSecondsPP,MSecondsAUXCG,MSecondsStrongBranching,MPSizeConstraints,MPSizeVariables,ColumnsAdded,PPNetworkConstructionTime,PPNetworkSizeNodes,PPNetworkSizeArcs,LazyConstraintAdded,BranchType,IndexParentBranchingNode,MSecondsFilterMPVars,MSecondsFilterPPNodes,VehicleID,TripID,MaintenanceID,FracValue,BranchValue,StabAlpha,StabMisPricings,PPSegmentsSkipped,LBLagrangian,EarlyTermination,PPVehicleSelection,PPVehiclesPriced,PPVehiclesImproving" << "\n";
 	
 	for (const Stats::PerformanceDetail& st : vecStatsPerformance)
 	{
@@ -113,7 +113,8 @@ void eva::DataOutput::writeStatsPerformanceDetail(const DataInput& input, const
 			st.TripId != Constants::BIG_UINTEGER ? fout << st.TripId << "," : fout << ","; // TripID, 
 			st.MaintenanceId != Constants::BIG_UINTEGER ? fout << st.MaintenanceId << "," : fout << ","; // MaintenanceID, 
 			fout << st.fractionalValue << ","; // FracValue, 
-			fout << st.branchValue << "\n"; // BranchValue"			
+			fout << st.branchValue << ","; // BranchValue
+			fout << ",,,,,,," << "\n"; // Empty[8]: StabAlpha,StabMisPricings,PPSegmentsSkipped,LBLagrangian,EarlyTermination,PPVehicleSelection,PPVehiclesPriced,PPVehiclesImproving
 		}
 		else {
 			fout << st.indexPlanningHorizon << ","; // IndexPlanningHorizon, 
@@ -140,7 +141,21 @@ void eva::DataOutput::writeStatsPerformanceDetail(const DataInput& input, const
 				fout << st.lazy_constraint_added << ","; // LazyConstraintAdded
 			else
 				fout << ","; // LazyConstraintAdded
-			fout << ",,,,,,,," << "\n"; // Empty[9]: BranchType,IndexParentBranchingNode,SecondsFilterMPVars,SecondsFilterPPNodes,VehicleID,TripID,MaintenanceID,FracValue,BranchValue
+			fout << ",,,,,,,,,"; // Empty[9]: BranchType,IndexParentBranchingNode,SecondsFilterMPVars,SecondsFilterPPNodes,VehicleID,TripID,MaintenanceID,FracValue,BranchValue
+			fout << st.stabilisation_alpha << ","; // StabAlpha
+			fout << st.stabilisation_misPricings << ","; // StabMisPricings
+			fout << st.pp_segments_skipped << ","; // PPSegmentsSkipped
+			st.lb_lagrangian > -Constants::BIG_DOUBLE ? fout << st.lb_lagrangian << "," : fout << ","; // LBLagrangian
+			if (st.early_termination != NULL)
+				fout << st.early_termination << ","; // EarlyTermination
+			else
+				fout << ","; // EarlyTermination
+			if (st.pp_vehicle_selection != NULL)
+				fout << st.pp_vehicle_selection << ","; // PPVehicleSelection
+			else
+				fout << ","; // PPVehicleSelection
+			fout << st.pp_vehicles_priced << ","; // PPVehiclesPriced
+			fout << st.pp_vehicles_improving << "\n"; // PPVehiclesImproving
 		};
 	}
 
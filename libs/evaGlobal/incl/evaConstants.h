@@ -6,6 +6,8 @@
 #include <ctime>
 #include <vector>
 
+#include "evaVehicleBitset.h"
+
 namespace eva {
 	struct Types
 	{
@@ -81,9 +83,11 @@ namespace eva {
 		const static bool compare_floats_smaller_equal(const double& a, const double& b);
 
 		// set(a) >= set(b)
-		const static bool compare_is_subset(const std::vector<Types::AccessType>& a, const std::vector<Types::AccessType>& b);
+		const static bool compare_is_subset(const VehicleBitset& a, const VehicleBitset& b);
 
 		const static Types::DateTime StringToDateTime(const std::string& str);
+		// Parses the fixed format %Y-%m-%d %H:%M:%S in [begin, end) without copying, and falls back to strptime otherwise:
+		const static Types::DateTime StringToDateTime(const char* begin, const char* end);
 		const static std::string DateTimeToString(const Types::DateTime& dt);
 		const static std::string DurationToString(const uint32_t& durInSeconds);
 		const static int64_t diffDateTime(const Types::DateTime& beginn, const Types::DateTime& end);
@@ -0,0 +1,130 @@
+#ifndef EVA_GLOBAL_VEHICLE_BITSET_H
+#define EVA_GLOBAL_VEHICLE_BITSET_H
+
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+
+namespace eva {
+	// Packed per-vehicle access set. One bit per vehicle, stored in 64-bit words.
+	// Bits beyond size() are always kept at zero, so that all set operations can work on full words.
+	class VehicleBitset
+	{
+		typedef uint64_t Word;
+		static const uint32_t BITS_PER_WORD = 64;
+
+		std::vector<Word> _words;
+		uint32_t _size = 0;
+
+		inline static uint32_t _nrWords(const uint32_t size) { return (size + BITS_PER_WORD - 1) / BITS_PER_WORD; };
+		inline static Word _mask(const uint32_t index) { return Word(1) << (index % BITS_PER_WORD); };
+
+		inline void _clearUnusedBits()
+		{
+			if (_size % BITS_PER_WORD != 0)
+				_words.back() &= (Word(1) << (_size % BITS_PER_WORD)) - 1;
+		};
+
+	public:
+		// CONSTRUCTORS:
+
+		VehicleBitset() {};
+
+		VehicleBitset(const uint32_t size, const bool value = false) :
+			_words(_nrWords(size), value ? ~Word(0) : Word(0)),
+			_size(size)
+		{
+			_clearUnusedBits();
+		};
+
+		// MODIFIERS:
+
+		inline void resize(const uint32_t size, const bool value = false)
+		{
+			const uint32_t oldSize = _size;
+			_words.resize(_nrWords(size), value ? ~Word(0) : Word(0));
+			_size = size;
+
+			// Bits of the previously last word are not covered by the resize of the words:
+			if (value)
+			{
+				for (uint32_t idx = oldSize; idx < size && idx % BITS_PER_WORD != 0; ++idx)
+					_words[idx / BITS_PER_WORD] |= _mask(idx);
+			}
+			_clearUnusedBits();
+		};
+
+		inline void set_all(const bool value)
+		{
+			std::fill(_words.begin(), _words.end(), value ? ~Word(0) : Word(0));
+			_clearUnusedBits();
+		};
+
+		inline void set(const uint32_t index, const bool value)
+		{
+			if (value)
+				_words[index / BITS_PER_WORD] |= _mask(index);
+			else
+				_words[index / BITS_PER_WORD] &= ~_mask(index);
+		};
+
+		// Plain word loops, that the compiler can vectorise:
+		inline VehicleBitset& operator&=(const VehicleBitset& other)
+		{
+			for (uint32_t idx = 0; idx < _words.size(); ++idx)
+				_words[idx] &= other._words[idx];
+			return *this;
+		};
+
+		inline VehicleBitset& operator|=(const VehicleBitset& other)
+		{
+			for (uint32_t idx = 0; idx < _words.size(); ++idx)
+				_words[idx] |= other._words[idx];
+			return *this;
+		};
+
+		// GETTERS:
+
+		inline const uint32_t size() const { return _size; };
+		inline const bool test(const uint32_t index) const { return (_words[index / BITS_PER_WORD] & _mask(index)) != 0; };
+
+		inline const uint32_t count() const
+		{
+			uint32_t res = 0;
+			for (const Word word : _words)
+				res += __builtin_popcountll(word);
+			return res;
+		};
+
+		inline const bool any() const
+		{
+			for (const Word word : _words)
+			{
+				if (word != 0)
+					return true;
+			}
+			return false;
+		};
+
+		inline const bool none() const { return !any(); };
+
+		// set(this) <= set(other)
+		inline const bool is_subset_of(const VehicleBitset& other) const
+		{
+			if (_size != other._size) return false;
+
+			Word res = 0;
+			for (uint32_t idx = 0; idx < _words.size(); ++idx)
+				res |= _words[idx] & ~other._words[idx];
+			return res == 0;
+		};
+
+		inline const bool operator==(const VehicleBitset& other) const { return _size == other._size && _words == other._words; };
+		inline const bool operator!=(const VehicleBitset& other) const { return !(*this == other); };
+	};
+
+	inline VehicleBitset operator&(VehicleBitset a, const VehicleBitset& b) { a &= b; return a; }
+	inline VehicleBitset operator|(VehicleBitset a, const VehicleBitset& b) { a |= b; return a; }
+}
+
+#endif /* EVA_GLOBAL_VEHICLE_BITSET_H */
@@ -40,23 +40,12 @@ const bool Helper::compare_floats_smaller_equal(const double& a, const double& b
 	return !compare_floats_smaller(b, a);
 }
 
-const bool eva::Helper::compare_is_subset(const std::vector<Types::AccessType> &a, const std::vector<Types::AccessType> &b)
+const bool eva::Helper::compare_is_subset(const VehicleBitset &a, const VehicleBitset &b)
 {
 	// Checks if b is a subset of a.
 	// e.g. [1, 1, 1, 0] has subset [0, 1, 1, 0], 
 	// but. [1, 1, 0, 0] has NOT subset [0, 1, 1, 0], 
-	if (a.size() != b.size()) return false;
-
-	for(Types::Index idx = 0; idx < a.size(); ++idx)
-	{
-		// must be a[idx] >= b[idx]
-		if(a[idx] < b[idx])
-		{
-			return false;
-		}
-	}
-
-    return true;
+	return b.is_subset_of(a);
 }
 
 const Types::DateTime Helper::StringToDateTime(const std::string &str)
@@ -73,6 +62,47 @@ const Types::DateTime Helper::StringToDateTime(const std::string &str)
 	return Types::DateTime(timegm(&tm));
 }
 
+const Types::DateTime Helper::StringToDateTime(const char* begin, const char* end)
+{
+	// Fixed format: YYYY-MM-DD HH:MM:SS, anything after the seconds is ignored (as with strptime):
+	static const char* FORMAT = "dddd-dd-dd dd:dd:dd";
+	static const std::ptrdiff_t FORMAT_LENGTH = 19;
+
+	bool isFixedFormat = (end - begin) >= FORMAT_LENGTH;
+	for (std::ptrdiff_t pos = 0; isFixedFormat && pos < FORMAT_LENGTH; ++pos)
+		isFixedFormat = FORMAT[pos] == 'd' ? (begin[pos] >= '0' && begin[pos] <= '9') : begin[pos] == FORMAT[pos];
+
+	if (!isFixedFormat)
+		return StringToDateTime(std::string(begin, end));
+
+	auto digits = [begin](const std::ptrdiff_t pos, const std::ptrdiff_t length) {
+		int64_t res = 0;
+		for (std::ptrdiff_t idx = pos; idx < pos + length; ++idx)
+			res = res * 10 + (begin[idx] - '0');
+		return res;
+	};
+
+	int64_t year = digits(0, 4);
+	const int64_t month = digits(5, 2);
+	const int64_t day = digits(8, 2);
+	const int64_t hour = digits(11, 2);
+	const int64_t minute = digits(14, 2);
+	const int64_t second = digits(17, 2);
+
+	if (month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 60)
+		throw InvalidArgumentError("Helper::StringToDateTime", "Date: " + std::string(begin, end) + " (string) not in correct date format or it is not specified.");
+
+	// Days since 1970-01-01 in the proleptic gregorian calendar, with the year starting in March:
+	year -= month <= 2;
+	const int64_t era = (year >= 0 ? year : year - 399) / 400;
+	const int64_t yearOfEra = year - era * 400;
+	const int64_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+	const int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+	const int64_t days = era * 146097 + dayOfEra - 719468;
+
+	return Types::DateTime(days * 86400 + hour * 3600 + minute * 60 + second);
+}
+
 const std::string Helper::DateTimeToString(const Types::DateTime& dt)
 {
 	char res[sizeof "YYYY-MM-DD HH:MM:SS+ZZZZ"];
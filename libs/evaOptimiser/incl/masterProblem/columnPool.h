@@ -0,0 +1,86 @@
+#ifndef EVA_COLUMN_POOL_H
+#define EVA_COLUMN_POOL_H
+
+#include "evaConstants.h"
+#include "incl/moderator/OptimisationInput.h"
+#include "incl/moderator/moderator.h"
+
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+namespace eva
+{
+	class ColumnPool
+	{
+		// Pool of the schedules removed from the RMP, that may be re-added once they price out again.
+		// The columns are stored densely, and are removed by swapping the last column into the gap. Each column is indexed by vehicle and by trip.
+		// The dual coefficients of the columns are stored in a compressed sparse layout, over one concatenated vector of all duals:
+		// [vehicles | trips | maintenances | prefix sums charger 0 | prefix sums charger 1 | ...]
+
+		const OptimisationInput& _optinput;
+
+		// COLUMNS:
+		std::vector<SubVehicleSchedule> _vecColumns;
+		std::vector<uint64_t> _vecIds; // Ids increase with the insertion, hence give the age of a column.
+		std::vector<double> _vecCost;
+		std::vector<uint32_t> _vecCoeffStart;
+		std::vector<uint32_t> _vecCoeffCount;
+		std::vector<double> _vecReducedCost;
+
+		// DUAL COEFFICIENTS:
+		std::vector<uint32_t> _vecCoeffIndex;
+		std::vector<double> _vecCoeffValue;
+		uint32_t _nrDeadCoeffs = 0; // Coefficients of removed columns, until the next compaction.
+
+		// INDEXES:
+		std::vector<std::vector<Types::Index>> _vecVehicleColumns;
+		std::vector<Types::Index> _vecPosInVehicleColumns;
+		std::vector<std::vector<Types::Index>> _vecTripColumns;
+		std::vector<std::vector<Types::Index>> _vecPosInTripColumns; // Per column, and per trip of the schedule.
+		std::deque<uint64_t> _deqInsertionOrder; // Ids of extracted columns remain, until they make up the majority.
+		std::unordered_map<uint64_t, Types::Index> _mapPosById;
+		uint64_t _nextId = 0;
+
+		// THREADS:
+		uint32_t _nr_threads = 1; // Threads used to update the reduced costs in parallel.
+
+		// DUALS:
+		uint32_t _offsetTrips = 0;
+		uint32_t _offsetMaintenances = 0;
+		std::vector<uint32_t> _vecOffsetChargers;
+		std::vector<double> _vecDualValues;
+
+		// FUNCTION DEFINITIONS:
+
+		void _addCoefficient(const uint32_t& indexDual, const double& value) { _vecCoeffIndex.push_back(indexDual); _vecCoeffValue.push_back(value); };
+		void _remove(const Types::Index& pos);
+		void _compact();
+		void _updateDualValues(const Duals& duals);
+		void _updateReducedCosts();
+
+	public:
+		ColumnPool() = delete;
+		ColumnPool(const OptimisationInput& optinput);
+
+		// FUNCTIONS:
+
+		// Adds the schedule. If the pool is full, the oldest schedule is removed first:
+		void push_back(SubVehicleSchedule schedule);
+
+		// Removes and returns the schedules with negative reduced cost, that are feasible in the branch node.
+		// Per vehicle, at most maxPerVehicle schedules are returned, preferring the oldest ones:
+		std::vector<std::vector<SubVehicleSchedule>> extract_columns(const Duals& duals, const BranchNode& brn, const uint32_t& maxPerVehicle);
+
+		// INLINE GETTERS:
+
+		inline const size_t size() const { return _vecColumns.size(); };
+
+		// INLINE SETTERS:
+
+		inline void set_nr_threads(const uint32_t nr_threads) { _nr_threads = std::max(static_cast<uint32_t>(1), nr_threads); };
+	};
+}
+
+#endif // !EVA_COLUMN_POOL_H
@@ -4,11 +4,13 @@
 #include "evaConstants.h"
 #include "incl/moderator/OptimisationInput.h"
 #include "incl/moderator/moderator.h"
+#include "columnPool.h"
 
 #include "Highs.h"
 
 #include <memory>
 #include <deque>
+#include <unordered_map>
 
 namespace eva
 {
@@ -20,6 +22,10 @@ namespace eva
 
 	public:
 		bool flagDelete = false;
+		uint32_t countExclusions = 0; // Number of applied branches that exclude the column.
+		uint32_t age = 0; // Number of solves since the column was last basic.
+		uint32_t countPositiveRc = 0; // Number of consecutive solves with a positive reduced cost.
+		bool isSynced = false; // The column is also known to the master problem, that this copy is synchronised with.
 
 		Variable() {};
 
@@ -31,6 +37,14 @@ namespace eva
 			_ptr(std::make_shared<T>(ref))
 		{};
 
+		Variable(
+			const HighsInt& var,
+			T&& ref
+		) :
+			_var(var),
+			_ptr(std::make_shared<T>(std::move(ref)))
+		{};
+
 		inline void set_var(const HighsInt& var) { _var = var; };
 		inline void set_basisStatus(const HighsBasisStatus& basisStatus) { _basisStatus = basisStatus; };
 
@@ -95,6 +109,36 @@ namespace eva
 		uint32_t columnsAdded;
 	};
 
+	struct ColumnBuffer
+	{
+		// Columns in compressed sparse column format, that are added to HiGHS with a single call.
+		// The buffer is reused over the iterations, hence it keeps its capacity after being cleared.
+		std::vector<double> vecCost;
+		std::vector<double> vecLb;
+		std::vector<double> vecUb;
+		std::vector<HighsInt> vecStarts;
+		std::vector<HighsInt> vecIndices;
+		std::vector<double> vecValues;
+
+		inline void clear() { vecCost.clear(); vecLb.clear(); vecUb.clear(); vecStarts.clear(); vecIndices.clear(); vecValues.clear(); };
+		inline void start_column(const double& cost, const double& lb, const double& ub) { vecCost.push_back(cost); vecLb.push_back(lb); vecUb.push_back(ub); vecStarts.push_back(static_cast<HighsInt>(vecIndices.size())); };
+		inline void add_coefficient(const HighsInt& row, const double& value) { vecIndices.push_back(row); vecValues.push_back(value); };
+		inline const HighsInt get_number_columns() const { return static_cast<HighsInt>(vecCost.size()); };
+	};
+
+	struct LagrangianEvaluation
+	{
+		double lb = -Constants::BIG_DOUBLE; // Only a valid bound if the pricing problem was solved to optimality.
+		double subgradientProduct = 0.0; // Product of the subgradient at the evaluated duals with a given direction.
+	};
+
+	struct ScheduleColumnRef
+	{
+		// Position of a schedule column in the schedules of its vehicle:
+		Types::Index indexVehicle;
+		Types::Index pos;
+	};
+
 	class MasterProblem
 	{
 		const OptimisationInput& _optinput;
@@ -110,7 +154,13 @@ namespace eva
 		std::vector<Variable<SubScheduleTripNodeData>> _vecVarUnallocatedTrips;
 		std::vector<Variable<Vehicle>> _vecVarVehicleSelected;
 		std::vector<std::vector<Variable<SubVehicleSchedule>>> _vecVarVehicleSchedules;
-		std::deque<SubVehicleSchedule> _vecPoolVehicleSchedule;
+		ColumnPool _columnPool;
+
+		// Branches applied to the schedule columns, and the columns per trip, maintenance and schedule node to find the columns affected by a branch:
+		std::vector<BranchKey> _vecAppliedBranches;
+		std::vector<std::vector<ScheduleColumnRef>> _vecTripScheduleColumns;
+		std::vector<std::vector<ScheduleColumnRef>> _vecMaintenanceScheduleColumns;
+		std::unordered_map<Types::Index, std::vector<ScheduleColumnRef>> _umapScheduleNodeScheduleColumns;
 
 		Constraint<Types::Index> _constrTotalNumberVehicles;
 		Constraint<Types::Index> _constrTotalNumberTripsUnassigned;
@@ -118,15 +168,21 @@ namespace eva
 		std::vector<Constraint<SubScheduleTripNodeData>> _vecConstrTripCoverage;
 		std::vector<Constraint<SubScheduleMaintenanceNodeData>> _vecConstrOneVehiclePerMaintenance;
 		std::vector<std::vector<Constraint<SubSchedulePutOnChargeNodeData>>> _vecConstrChargerCapacity;
+		ColumnBuffer _columnBuffer;
 		
 		HighsInt _addColumn(const double& cost, const double& lb, const double& ub, const HighsInt& number_nz_coeff, const HighsInt* indices, const double* values);
+		HighsInt _addColumns(const ColumnBuffer& columnBuffer);
 		HighsInt _addRow(const double& lb, const double& ub, const HighsInt& number_nz_coeff, const HighsInt* indices, const double* values);
+		HighsInt _addRows(const HighsInt& number_rows, const double* lb, const double* ub, const HighsInt& number_nz_coeff, const HighsInt* starts, const HighsInt* indices, const double* values);
 		HighsInt _addRow(const double& lb, const double& ub);
 		HighsInt _addRow(const double& val);
 
 		int64_t _mseconds_runtimeSolver = 0;
 		int64_t _mseconds_filterVars = 0;
 		HighsInt _VAR_SCHEDULES_START = 0;
+		uint32_t _countSolvesSinceCleanUp = 0;
+		bool _flagIntegerObjective = false; // All objective coefficients are integer, as decided once from the cost configuration.
+		uint32_t _nr_threads = 1; // Threads of the HiGHS instance and of the column pool.
 
 		void _addVars();
 		void _addConstrs();
@@ -137,6 +193,8 @@ namespace eva
 		void _addConstrTripCoverage();
 		void _addConstrOneVehiclePerMaintenance();
 		void _addTempConstrChargerCapacity();
+		void _addConstrsChargerCapacity(const std::vector<std::vector<Types::Index>>& vecSlotsPerCharger);
+		void _addScheduleColumns(std::vector<SubVehicleSchedule>& vecSchedules, const bool include_cost);
 		
 		void _addVarTotalVehiclesSlack();
 		void _addVarTotalNumberTripsUnassignedSlack();
@@ -144,12 +202,19 @@ namespace eva
 		void _addVarsVehicleSelected();
 
 		void _initialise();
+		void _initialiseSolverOptions();
 
 		void _updateCurrentDuals();
 		void _updateSolutionStatus();
 		void _clean_up(const uint32_t& numberDelete);
 
+		const bool _isExcludedBy(const BranchKey& key, const SubVehicleSchedule& schedule) const;
+		void _updateExclusions(const BranchKey& key, const bool apply, std::vector<ScheduleColumnRef>& vecUpdatedColumns);
+		void _indexScheduleColumn(const Types::Index& indexVehicle, const Types::Index& pos);
+		void _rebuildScheduleColumnIndexes();
+
 		const double& _getDual(const HighsInt& constr);
+		std::vector<double> _getRowDuals(const Duals& duals) const;
 
 		std::vector<Branch> _get_vecBranchOptionsTotalVehicles();
 		std::vector<Branch> _get_vecBranchOptionsTotalNumberTripsUnassigned();
@@ -174,11 +239,16 @@ namespace eva
 			const OptimisationInput& optinput
 		) :
 			_optinput(optinput),
-			_currentDuals(optinput)
+			_currentDuals(optinput),
+			_columnPool(optinput),
+			_nr_threads(optinput.get_config().get_const_nr_threads())
 		{
 			_initialise();
 		};
 
+		// Independent copy with its own serial HiGHS instance, warm started from the basis of the other master problem:
+		MasterProblem(const MasterProblem& other);
+
 		void filterVars(const BranchNode& brn);
 		void writeModel();
 		bool solve();
@@ -191,13 +261,22 @@ namespace eva
 
 		StatusVarSchedulesAdded addVarsSchedule(std::vector<std::vector<SubVehicleSchedule>>& vecSchedules, const bool include_cost);
 		StatusVarSchedulesAdded addPoolVarsSchedule(const Duals& duals, const BranchNode& brn, const bool include_cost);
+		LagrangianEvaluation evaluate_lagrangian(const Duals& duals, const Duals& direction, const std::vector<std::vector<SubVehicleSchedule>>& vecSchedules) const;
 
 		void store_schedule_in_pool(const SubVehicleSchedule& schedule);
+		void set_nr_threads(const uint32_t nr_threads); // With a single thread, HiGHS runs serial.
+
+		// Adds the charger capacity rows and the schedule columns of the other master problem, that are missing in this copy:
+		void sync_with(const MasterProblem& other);
+
+		// Returns the schedule columns that this copy generated since it was created or last asked, which the other master problem does not know:
+		std::vector<SubVehicleSchedule> extract_unsynced_schedules();
 		
 		// GETTERS
 
 		std::vector<Branch> get_vecBranchOptions();
 		Solution get_currentSolution();
+		std::vector<SubVehicleSchedule> get_vecActiveSchedules() const;
 		const std::vector<std::pair<double,double>> get_vecLookupColumnBounds() const;
 		const bool check_aux_variables_feasible(const std::vector<std::pair<double, double>>& vecBounds);
 		
@@ -206,6 +285,7 @@ namespace eva
 		inline const double get_currentObjective() const { return _model.getInfo().objective_function_value; };
 		inline const HighsBasis& get_currentBasis() const { return _model.getBasis(); };
 		inline const MasterProblemSolutionStatus get_currentSolutionStatus() const { return _currentSolutionStatus; };
+		inline const bool has_integer_objective(const bool include_cost) const { return include_cost && _flagIntegerObjective; }; // Only the objective with the schedule costs is integer.
 
 		inline const int64_t get_totalRuntimeSolver() const { return _mseconds_runtimeSolver; };
 		inline const int64_t get_totalRuntimeFilterVars() const { return _mseconds_filterVars; };
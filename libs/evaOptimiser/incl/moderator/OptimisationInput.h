@@ -60,6 +60,7 @@ namespace eva
 		inline const Chargers& get_chargers() const { return _dataHandler.get_chargers(); };
 		inline const Charger& get_charger(const Types::Index& index) const { return _dataHandler.get_chargers().get_vec()[index]; };
 		inline const Location& get_location(const Types::Index& index) const { return _dataHandler.get_locations().get_vec()[index]; };
+		inline const TravelMatrix& get_travelMatrix() const { return _dataHandler.get_locations().get_travelMatrix(); };
 
 		inline const std::vector<SubScheduleTripNodeData>& get_vecTrips() const { return _vecTrips; };
 		inline const SubScheduleTripNodeData& get_trip(const Types::Index& index) const { return _vecTrips[index]; };
@@ -9,8 +9,10 @@
 #include "Highs.h"
 
 #include <boost/functional/hash.hpp>
+#include <algorithm>
 #include <unordered_map>
 #include <tuple>
+#include <memory>
 
 namespace eva
 {
@@ -18,7 +20,9 @@ namespace eva
 		std::vector<double> vecDualsOneSchedulePerVehicle;
 		std::vector<double> vecDualsTripCoverage;
 		std::vector<double> vecDualsOneVehiclePerMaintenance;
-		std::vector<std::vector<std::vector<double>>> vecCumSumDualsChargerCapacity;
+		std::vector<std::vector<double>> vecPrefixSumDualsChargerCapacity; // Per charger: entry k holds the sum of the duals of the capacity constraints [0, k).
+		double dualTotalNumberVehicles = 0.0;
+		double dualTotalNumberTripsUnassigned = 0.0;
 
 		Duals() = delete;
 
@@ -28,11 +32,77 @@ namespace eva
 			vecDualsOneSchedulePerVehicle(std::vector<double>(optinput.get_vehicles().get_vec().size() , 0.0)),
 			vecDualsTripCoverage(std::vector<double>(optinput.get_vecTrips().size(), 0.0)),
 			vecDualsOneVehiclePerMaintenance(std::vector<double>(optinput.get_vecMaintenances().size(), 0.0)),
-			vecCumSumDualsChargerCapacity(std::vector < std::vector<std::vector<double>>>(optinput.get_chargers().get_vec().size()))
+			vecPrefixSumDualsChargerCapacity(std::vector<std::vector<double>>(optinput.get_chargers().get_vec().size()))
 		{
 			initialise(optinput);
 		};
 		void initialise(const OptimisationInput& optinput);
+
+		// Overrides all duals with the weighted sum: weightLhs * lhs + weightRhs * rhs.
+		void set_linearCombination(const double& weightLhs, const Duals& lhs, const double& weightRhs, const Duals& rhs);
+
+		// Sum of the duals of all capacity constraints of the charger from indexPutOn up to and including indexTakeOff:
+		inline const double get_sumDualsChargerCapacity(const Types::Index& indexCharger, const Types::Index& indexPutOn, const Types::Index& indexTakeOff) const { return vecPrefixSumDualsChargerCapacity[indexCharger][indexTakeOff + 1] - vecPrefixSumDualsChargerCapacity[indexCharger][indexPutOn]; };
+	};
+
+	class HorizonDuals
+	{
+		// The duals of a planning horizon, keyed by the schedule node indexes instead of the horizon-local indexes,
+		// such that they remain valid after the planning horizon has been moved forward.
+
+		std::vector<double> _vecDualsOneSchedulePerVehicle;
+		std::unordered_map<Types::Index, double> _umapDualsTripCoverage;
+		std::unordered_map<Types::Index, double> _umapDualsOneVehiclePerMaintenance;
+		std::vector<std::unordered_map<Types::Index, double>> _vecUmapDualsChargerCapacity; // Per charger, keyed by the schedule node of the put on charge node.
+		double _dualTotalNumberVehicles = 0.0;
+		double _dualTotalNumberTripsUnassigned = 0.0;
+		bool _isSet = false;
+
+	public:
+		void store(const OptimisationInput& optinput, const Duals& duals);
+
+		// Maps the stored duals onto the current planning horizon. Trips, that were not part of the previous planning horizon,
+		// are priced at the cost of leaving them uncovered, all other new constraints with a zero dual:
+		void seed(const OptimisationInput& optinput, Duals& duals) const;
+
+		inline const bool is_set() const { return _isSet; };
+	};
+
+	class DualStabilisation
+	{
+		// Wentges smoothing: the pricing problem is solved with the separation duals alpha * center + (1 - alpha) * current duals.
+		// The stability center is the dual solution with the best known lagrangian bound.
+
+		Duals _center;
+		Duals _separation;
+		Duals _direction;
+		double _lbCenter = -Constants::BIG_DOUBLE;
+		double _alpha = 0.0;
+		bool _hasCenter = false;
+
+	public:
+		static constexpr double MAX_ALPHA = 0.9;
+		static constexpr double STEP_ALPHA = 0.1;
+
+		DualStabilisation() = delete;
+		DualStabilisation(
+			const OptimisationInput& optinput
+		) :
+			_center(optinput),
+			_separation(optinput),
+			_direction(optinput),
+			_alpha(std::min(MAX_ALPHA, std::max(0.0, optinput.get_config().get_const_dual_smoothing_alpha())))
+		{};
+
+		const double get_misPricingAlpha(const uint32_t& misPricings) const;
+		const Duals& update_separationDuals(const Duals& duals, const double& alpha);
+		const Duals& update_direction(const Duals& duals);
+		void update_center(const Duals& duals, const double& lb);
+		void update_alpha(const double& subgradientProduct);
+
+		inline const bool has_center() const { return _hasCenter; };
+		inline const double& get_alpha() const { return _alpha; };
+		inline const double& get_lbCenter() const { return _lbCenter; };
 	};
 
 	struct ChargingSchedule
@@ -89,6 +159,51 @@ namespace eva
 		}
 	};
 
+	struct BranchKey
+	{
+		// The part of a branch that restricts the schedules of the vehicles, shared by the RMP and the pricing networks.
+		// Branches that restrict no schedules have an undefined type.
+		BranchType type = BranchType::UNDEFINED;
+		bool value = false;
+		Types::Index indexElement = Constants::BIG_INDEX; // Trip, maintenance or schedule node index, depending on the type.
+		Types::Index indexVehicle = Constants::BIG_INDEX;
+		Types::Index indexCharger = Constants::BIG_INDEX;
+
+		inline const bool adds_fixing() const { return value && indexVehicle != Constants::BIG_INDEX; };
+
+		bool operator==(const BranchKey& other) const {
+			return type == other.type
+				&& value == other.value
+				&& indexElement == other.indexElement
+				&& indexVehicle == other.indexVehicle
+				&& indexCharger == other.indexCharger;
+		}
+	};
+
+	const BranchKey get_branchKey(const Branch& branch);
+
+	struct BranchPath
+	{
+		// Persistent path of the search tree: Each entry stores only the branch added at a node, and a handle on the entry of its parent.
+		// The entries are shared by all nodes in the subtree. The root of the search has no entry.
+		std::shared_ptr<const BranchPath> ptrParent;
+		Branch branch;
+	};
+
+	struct OpenBranchNode
+	{
+		// Compact record of an open node in the best-first search. The full node is only rebuilt once it is activated:
+		Types::Index index = Constants::BIG_INDEX;
+		double lb = -Constants::BIG_DOUBLE;
+		std::shared_ptr<const BranchPath> ptrPath;
+		std::shared_ptr<const std::vector<Branch>> ptrSortedBranchOptions;
+
+		struct CompareLb
+		{
+			bool operator()(const OpenBranchNode& l, const OpenBranchNode& r) { return Helper::compare_floats_smaller(r.lb, l.lb); };
+		};
+	};
+
 	class BranchNode
 	{
 	
@@ -106,6 +221,7 @@ namespace eva
 
 		void _initialise_root(const OptimisationInput& optinput);
 		void _initialise_child(const Branch& newBranch, const OptimisationInput& optinput);
+		void _initialise_open(const OpenBranchNode& openBranchNode, const OptimisationInput& optinput);
 		void _update_vehicleFixings(const Branch& newBranch);
 		void _prepare_fixings(const OptimisationInput& optinput);
 
@@ -138,6 +254,20 @@ namespace eva
 			_initialise_child(newBranch, optinput);
 		}		
 
+		// Rebuild an open node from the root of the search, and the branches on its path:
+		BranchNode(
+			const OpenBranchNode& openBranchNode,
+			const BranchNode& rootBranchNode,
+			const OptimisationInput& optinput
+		) :
+			_index(openBranchNode.index),
+			_vecBranches(rootBranchNode.get_vecBranches()),
+			_lb(openBranchNode.lb),
+			_vecVehicleFixings(rootBranchNode.get_vecVehicleFixings())
+		{
+			_initialise_open(openBranchNode, optinput);
+		}
+
 		// FUNCTIONS:
 
 		inline void pop_back_vecBranchOptions() { _vecSortedBranchOptions.pop_back(); };
@@ -148,6 +278,7 @@ namespace eva
 		void store_branchOptionsTruncColumnGeneration(const std::vector<Branch>& vecBranchOptions);
 		void store_branchOptionsBranchAndPrice(const std::vector<Branch>& vecBranchOptions);
 		void writeBranchesToConsole();
+		OpenBranchNode get_openBranchNode(const std::shared_ptr<const BranchPath>& ptrPath) const;
 
 		// INLINE GETTERS:
 
@@ -159,13 +290,6 @@ namespace eva
 		inline const std::vector<std::vector<Types::Index>>& get_vecVehicleFixings() const { return _vecVehicleFixings;};
 		inline const Types::DateTime& get_vehicleFixedNodeNextMaxEndTime(const Types::Index& indexVehicle, const Types::Index& indexScheduleNode) const {return _vecVehicleFixedEndTimeLookup[indexVehicle].at(indexScheduleNode);};
 		inline const Types::DateTime& get_vehicleFixedNodePrevMinStartTime(const Types::Index& indexVehicle, const Types::Index& indexScheduleNode) const {return _vecVehicleFixedStartTimeLookup[indexVehicle].at(indexScheduleNode);};
-	
-		// CLASS FUNCITONS:
-
-		struct CompareLb
-		{
-			bool operator()(const BranchNode& l, const BranchNode& r) { return Helper::compare_floats_smaller(r.get_lb(), l.get_lb()); };
-		};
 	};
 	
 	struct SubVehicleSchedule : public VehicleSchedule
@@ -177,6 +301,14 @@ namespace eva
 		std::vector<Types::Index> vecMaintenanceNodesIndexes;
 		std::vector<ChargingSchedule> vecChargingSchedule;
 
+		// Signature of the schedule, set by update_signature:
+		// The hash identifies duplicates. The bloom-style masks hold one bit per trip and maintenance, and one bit per charger.
+		size_t signatureHash = 0;
+		uint64_t signatureActivityMask = 0;
+		uint64_t signatureChargerMask = 0;
+
+		void update_signature();
+
 		// INLINE CONST
 		inline const bool hasTrip(const Types::Index& indexTrip) const { return std::find(vecTripNodeIndexes.begin(), vecTripNodeIndexes.end(), indexTrip) != vecTripNodeIndexes.end(); };
 		inline const bool hasMaintenance(const Types::Index& indexMaintenance) const { return std::find(vecMaintenanceNodesIndexes.begin(), vecMaintenanceNodesIndexes.end(), indexMaintenance) != vecMaintenanceNodesIndexes.end(); };
@@ -185,6 +317,10 @@ namespace eva
 		
 
 		const bool isSubsetOf(const SubVehicleSchedule& other) const;
+		const bool isIdenticalTo(const SubVehicleSchedule& other) const;
+
+		// Necessary condition for isSubsetOf, from the signatures of both schedules:
+		inline const bool mayBeSubsetOf(const SubVehicleSchedule& other) const { return (signatureActivityMask & ~other.signatureActivityMask) == 0 && (other.signatureChargerMask & ~signatureChargerMask) == 0; };
 
 		const bool isFeasibleInBranchNode(const BranchNode& brn) const;
 		const double get_current_reducedCost(const Duals& duals) const;
@@ -212,6 +348,7 @@ namespace eva
 	
 		void _initialise(const OptimisationInput& optinput);
 		void _update_moving_average(std::pair<double, uint32_t>& cur, const double& new_data_point);
+		void _merge_moving_average(std::pair<double, uint32_t>& cur, const std::pair<double, uint32_t>& other, const std::pair<double, uint32_t>& base);
 
 	public:
 		BranchEvaluator() = delete;
@@ -221,6 +358,7 @@ namespace eva
 
 		void update_branch_mean_score(const Branch& branch);
 		const double get_mean_score(const Branch& branch) const;
+		void merge(const BranchEvaluator& other, const BranchEvaluator& base); // Add the scores that other recorded since it was copied from base.
 	};
 
 };
@@ -0,0 +1,251 @@
+#ifndef EVA_LABEL_SETTING_H
+#define EVA_LABEL_SETTING_H
+
+#include "evaConstants.h"
+#include "evaExceptions.h"
+
+#include <boost/config.hpp>
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/topological_sort.hpp>
+
+#include <vector>
+#include <iterator>
+#include <algorithm>
+
+namespace eva
+{
+	namespace labelling
+	{
+		// Label setting algorithm for resource constrained shortest paths on acyclic graphs.
+		//
+		// All pricing networks are acyclic in time. Hence, the vertices can be processed in topological order,
+		// and all labels at a vertex are final once the vertex is reached. The labels of a vertex are kept in a contiguous bucket,
+		// sorted by a primary key of the resource container. The key must be a lower bound on dominance:
+		// if res_cont_1 dominates res_cont_2, then key(res_cont_1) <= key(res_cont_2) + EPS.
+		// This allows to stop the dominance scans of a bucket early.
+		//
+		// The resource extension function, dominance function and visitor follow the same interface as boost::r_c_shortest_paths.
+		//
+		// As the labels are not processed by priority, stopping the search early would favour the labels of the vertices that come first in time.
+		// Instead, the heuristic mode bounds the label setting: with maxSolutions > 0, every bucket only keeps the maxSolutions labels with the smallest key.
+		// Hence, at most maxSolutions labels are extended per vertex, and at most maxSolutions labels are returned at the sink.
+		// Returns true, if the search was exhaustive: neither stopped by the visitor, nor were labels discarded by the bound.
+
+		template <class ResourceContainer, class Edge>
+		struct Label
+		{
+			ResourceContainer cumulated_resource_consumption;
+			double key = 0.0;
+			Types::Index indexPredecessor = Constants::BIG_INDEX;
+			Edge predEdge;
+
+			Label(
+				const ResourceContainer &resourceContainer,
+				const double &key,
+				const Types::Index &indexPredecessor,
+				const Edge &predEdge) : cumulated_resource_consumption(resourceContainer),
+										key(key),
+										indexPredecessor(indexPredecessor),
+										predEdge(predEdge) {};
+		};
+
+		class DefaultLabelSettingVisitor
+		{
+		public:
+			template <class Queue, class Graph>
+			bool on_enter_loop(const Queue & /*queue*/, const Graph & /*graph*/) { return true; }
+
+			template <class Label, class Graph>
+			void on_label_popped(const Label & /*l*/, const Graph & /*g*/) {}
+
+			template <class Label, class Graph>
+			void on_label_feasible(const Label & /*l*/, const Graph & /*g*/) {}
+
+			template <class Label, class Graph>
+			void on_label_not_feasible(const Label & /*l*/, const Graph & /*g*/) {}
+
+			template <class Label, class Graph>
+			void on_label_dominated(const Label & /*l*/, const Graph & /*g*/) {}
+
+			template <class Label, class Graph>
+			void on_label_not_dominated(const Label & /*l*/, const Graph & /*g*/) {}
+		};
+
+		// Determines the processing order of the vertices. Throws, if the graph contains a cycle.
+		template <class Graph>
+		std::vector<typename boost::graph_traits<Graph>::vertex_descriptor> get_topological_order(const Graph &graph)
+		{
+			typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
+
+			std::vector<Vertex> vecTopologicalOrder;
+			vecTopologicalOrder.reserve(boost::num_vertices(graph));
+
+			try
+			{
+				boost::topological_sort(graph, std::back_inserter(vecTopologicalOrder));
+			}
+			catch (const boost::not_a_dag &)
+			{
+				throw LogicError("eva::labelling::get_topological_order", "The network is not acyclic.");
+			}
+
+			// The topological sort returns the vertices in reverse order:
+			std::reverse(vecTopologicalOrder.begin(), vecTopologicalOrder.end());
+			return vecTopologicalOrder;
+		}
+
+		template <class Graph,
+				  class ResourceContainer,
+				  class ResourceExtensionFunction,
+				  class DominanceFunction,
+				  class LabelKeyFunction,
+				  class Visitor>
+		bool label_setting_shortest_paths(
+			const Graph &graph,
+			const std::vector<typename boost::graph_traits<Graph>::vertex_descriptor> &vecTopologicalOrder,
+			const typename boost::graph_traits<Graph>::vertex_descriptor source,
+			const typename boost::graph_traits<Graph>::vertex_descriptor sink,
+			std::vector<std::vector<typename boost::graph_traits<Graph>::edge_descriptor>> &pareto_optimal_solutions,
+			std::vector<ResourceContainer> &pareto_optimal_resource_containers,
+			const ResourceContainer &initialResourceContainer,
+			const ResourceExtensionFunction &ref,
+			const DominanceFunction &dominance,
+			const LabelKeyFunction &key,
+			Visitor &visitor,
+			const size_t maxSolutions = 0) // 0: Keep all non-dominated labels at every vertex.
+		{
+			typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
+			typedef typename boost::graph_traits<Graph>::edge_descriptor Edge;
+			typedef Label<ResourceContainer, Edge> GraphLabel;
+
+			pareto_optimal_solutions.clear();
+			pareto_optimal_resource_containers.clear();
+
+			if (vecTopologicalOrder.size() != boost::num_vertices(graph))
+				throw LogicError("eva::labelling::label_setting_shortest_paths", "Topological order does not match the network.");
+
+			// All labels are stored contiguously. The buckets only refer to the labels by their position:
+			std::vector<GraphLabel> vecLabels;
+			std::vector<std::vector<Types::Index>> vecBuckets(boost::num_vertices(graph));
+
+			vecLabels.push_back(GraphLabel(initialResourceContainer, key(initialResourceContainer), Constants::BIG_INDEX, Edge()));
+			vecBuckets[source].push_back(0);
+
+			// Skip all vertices that come before the source:
+			auto iterVertex = std::find(vecTopologicalOrder.begin(), vecTopologicalOrder.end(), source);
+
+			bool isTerminated = false;
+			bool isBounded = false;
+			for (; iterVertex != vecTopologicalOrder.end() && !isTerminated; ++iterVertex)
+			{
+				const Vertex vertex = *iterVertex;
+
+				// Labels at the sink are never extended:
+				if (vertex == sink)
+					continue;
+
+				// All labels at the vertex are final, because all predecessors have been processed:
+				for (Types::Index posLabel = 0; posLabel < vecBuckets[vertex].size(); ++posLabel)
+				{
+					if (!visitor.on_enter_loop(vecTopologicalOrder, graph))
+					{
+						isTerminated = true;
+						break;
+					}
+
+					const Types::Index indexLabel = vecBuckets[vertex][posLabel];
+					visitor.on_label_popped(vecLabels[indexLabel], graph);
+
+					typename boost::graph_traits<Graph>::out_edge_iterator iterArc, iterArcEnd;
+					for (boost::tie(iterArc, iterArcEnd) = boost::out_edges(vertex, graph); iterArc != iterArcEnd; ++iterArc)
+					{
+						// Extend the label along the arc:
+						ResourceContainer newResourceContainer = vecLabels[indexLabel].cumulated_resource_consumption;
+						if (!ref(graph, newResourceContainer, vecLabels[indexLabel].cumulated_resource_consumption, *iterArc))
+						{
+							visitor.on_label_not_feasible(GraphLabel(newResourceContainer, 0.0, indexLabel, *iterArc), graph);
+							continue;
+						}
+
+						GraphLabel newLabel(newResourceContainer, key(newResourceContainer), indexLabel, *iterArc);
+						visitor.on_label_feasible(newLabel, graph);
+
+						std::vector<Types::Index> &vecTargetBucket = vecBuckets[boost::target(*iterArc, graph)];
+
+						// In the bounded mode, a full bucket only accepts a label with a smaller key than its worst label:
+						if (maxSolutions > 0 && vecTargetBucket.size() >= maxSolutions && !Helper::compare_floats_smaller(newLabel.key, vecLabels[vecTargetBucket.back()].key))
+						{
+							isBounded = true;
+							continue;
+						}
+
+						// a. Check if the new label is dominated.
+						// Only labels with a key that is not bigger than the new key can dominate it:
+						bool isDominated = false;
+						for (const Types::Index &indexOther : vecTargetBucket)
+						{
+							if (Helper::compare_floats_smaller(newLabel.key, vecLabels[indexOther].key))
+								break;
+
+							if (dominance(vecLabels[indexOther].cumulated_resource_consumption, newLabel.cumulated_resource_consumption))
+							{
+								isDominated = true;
+								break;
+							}
+						}
+
+						if (isDominated)
+						{
+							visitor.on_label_dominated(newLabel, graph);
+							continue;
+						}
+						visitor.on_label_not_dominated(newLabel, graph);
+
+						// b. Remove all labels that are dominated by the new label.
+						// Only labels with a key that is not smaller than the new key can be dominated:
+						auto iterOther = std::lower_bound(vecTargetBucket.begin(), vecTargetBucket.end(), newLabel.key - Constants::EPS,
+														  [&](const Types::Index &l, const double value)
+														  { return vecLabels[l].key < value; });
+						auto iterKeep = iterOther;
+						for (; iterOther != vecTargetBucket.end(); ++iterOther)
+						{
+							if (!dominance(newLabel.cumulated_resource_consumption, vecLabels[*iterOther].cumulated_resource_consumption))
+								*iterKeep++ = *iterOther;
+						}
+						vecTargetBucket.erase(iterKeep, vecTargetBucket.end());
+
+						// c. Insert the new label in sorted order:
+						vecLabels.push_back(newLabel);
+						vecTargetBucket.insert(
+							std::upper_bound(vecTargetBucket.begin(), vecTargetBucket.end(), newLabel.key,
+											 [&](const double value, const Types::Index &r)
+											 { return value < vecLabels[r].key; }),
+							vecLabels.size() - 1);
+
+						// d. In the bounded mode, discard the label with the biggest key of an overfull bucket. It was not extended yet:
+						if (maxSolutions > 0 && vecTargetBucket.size() > maxSolutions)
+						{
+							vecTargetBucket.pop_back();
+							isBounded = true;
+						}
+					}
+				}
+			}
+
+			// Store the labels at the sink. The arcs of each path are stored from the sink to the source, as in boost::r_c_shortest_paths:
+			for (const Types::Index &indexLabel : vecBuckets[sink])
+			{
+				std::vector<Edge> vecPath;
+				for (Types::Index indexCur = indexLabel; vecLabels[indexCur].indexPredecessor != Constants::BIG_INDEX; indexCur = vecLabels[indexCur].indexPredecessor)
+					vecPath.push_back(vecLabels[indexCur].predEdge);
+
+				pareto_optimal_solutions.push_back(vecPath);
+				pareto_optimal_resource_containers.push_back(vecLabels[indexLabel].cumulated_resource_consumption);
+			}
+
+			return !isTerminated && !isBounded;
+		}
+	}
+}
+
+#endif // EVA_LABEL_SETTING_H
@@ -8,6 +8,7 @@
 #include "timeSpace/timeSpaceNetwork.h"
 #include "segmentBased/connectionNetwork/segmentConnectionNetwork.h"
 #include "segmentBased/centralisedNetwork/segmentCentralisedNetwork.h"
+#include "vehicleSelector.h"
 
 namespace eva
 {
@@ -24,12 +25,14 @@ namespace eva
 		tsn::TimeSpaceNetwork _tsn;
 		sbn::con::ConnectionBasedSegmentNetwork _connection_sbn;
 		sbn::cen::CentralisedBasedSegmentNetwork _centralised_sbn;
+		VehicleSelector _vehicleSelector;
 
 		int64_t _mseconds_runtimeSolver = 0;
 		int64_t _mseconds_filterNodeAccess = 0;
 		int64_t _network_construction_ms = 0;
 		uint32_t _network_size_nodes = 0;
 		uint32_t _network_size_arcs = 0;
+		uint32_t _nr_threads = 1;
 
 		void _initialise();
 		PricingProblemResult _tsn_find_neg_reduced_cost_schedule(const Duals& duals, const BranchNode& brn, const bool include_cost,const bool solve_to_optimal, const bool solve_all_vehicles, const std::chrono::high_resolution_clock::time_point& timeOutClock);
@@ -42,29 +45,44 @@ namespace eva
 		void _solve_connection_sbn_pricing_problem(const std::vector<Types::Index>& vecVehicleIndexes, PricingProblemResult& result, const Duals& duals, const BranchNode& brn, const bool include_cost,const bool solve_to_optimal, bool& isSolvedOptimal, const std::chrono::high_resolution_clock::time_point& timeOutClock);
 		void _solve_centralised_sbn_pricing_problem(const std::vector<Types::Index>& vecVehicleIndexes, PricingProblemResult& result, const Duals& duals, const BranchNode& brn, const bool include_cost,const bool solve_to_optimal, bool& isSolvedOptimal, const std::chrono::high_resolution_clock::time_point& timeOutClock);
 		
-		std::vector<Types::Index> _shuffleVecVehicleRotation(const std::vector<uint8_t>& vecVehicleRotation);
+		const uint32_t _get_batchSize() const; // Number of vehicles priced per batch of the partial pricing.
 
 	public:
 		PricingProblem(
 			const OptimisationInput& optinput
+		) :
+			PricingProblem(optinput, optinput.get_config().get_const_nr_threads())
+		{};
+
+		// Pricing problem of a worker, that prices and builds its network with nr_threads threads:
+		PricingProblem(
+			const OptimisationInput& optinput,
+			const uint32_t nr_threads
 		) :
 			_optinput(optinput),
 			_tsn(optinput),
 			_connection_sbn(optinput),
-			_centralised_sbn(optinput)
+			_centralised_sbn(optinput),
+			_vehicleSelector(optinput)
 		{
+			set_nr_threads(nr_threads);
 			_initialise();
 		};
 
 		PricingProblemResult find_neg_reduced_cost_schedule(const Duals& duals, const BranchNode& brn, const bool include_cost,const bool solve_to_optimal, const bool solve_all_vehicles, const std::chrono::high_resolution_clock::time_point& timeOutClock);
 		void updateNodeAccess(const BranchNode& brn);
 		const uint32_t get_number_segments() const;
+		const uint32_t get_number_skipped_segments() const; // Segments whose labelling was skipped in the last update, because their duals were unchanged.
+		void set_nr_threads(const uint32_t nr_threads); // Threads used to price the vehicles, and to update the segment networks in parallel.
 		
 		inline const int64_t get_totalRuntimeSolver() const { return _mseconds_runtimeSolver; };
 		inline const int64_t get_totalRuntimeFilterNodes() const { return _mseconds_filterNodeAccess; };
 		inline const int64_t get_network_construction_ms() const { return _network_construction_ms; };
 		inline const uint32_t get_network_size_nodes() const { return _network_size_nodes; };
 		inline const uint32_t get_network_size_arcs() const { return _network_size_arcs; };
+		inline const char* get_vehicleSelectionPolicy() const { return _vehicleSelector.get_policyName(); };
+		inline const uint64_t get_nrVehiclesPriced() const { return _vehicleSelector.get_nrVehiclesPriced(); };
+		inline const uint64_t get_nrVehiclesImproving() const { return _vehicleSelector.get_nrVehiclesImproving(); }; // Priced vehicles that yielded a negative reduced cost schedule.
 	};
 }
 
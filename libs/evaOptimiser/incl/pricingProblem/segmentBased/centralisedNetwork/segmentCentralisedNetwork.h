@@ -178,7 +178,7 @@ namespace eva
 												_solve_optimal(solve_optimal), _timeOutClock(timeOutClock)  {};
 
 				template <class Queue, class Graph>
-				bool on_enter_loop(const Queue &queue, const Graph &graph)
+				bool on_enter_loop(const Queue & /*queue*/, const Graph & /*graph*/)
 				{
 					// Stop entering the loop because the limit has been reached.
 					// It only counts processed labels. There can exist more labels at the sink node that just haven't been processed yet.
@@ -189,7 +189,7 @@ namespace eva
 				}
 
 				template <class Label, class Graph>
-				void on_label_feasible(Label &l, const Graph &g)
+				void on_label_feasible(Label &l, const Graph & /*g*/)
 				{
 					if (l.cumulated_resource_consumption.isEndSchedule)
 					{
@@ -211,6 +211,7 @@ namespace eva
 				const OptimisationInput &_optinput;
 				FixAtEndChargingStrategy _chargingStrategy;
 				Segments _segments;
+				uint32_t _nr_threads; // Threads used to update the segments and to build the network in parallel.
 
 				BoostCentralisedBasedNetwork _boostSegmentNetwork;
 				std::vector<BoostCentralisedBasedNode> _vecVehicleStartNodes;
@@ -254,7 +255,7 @@ namespace eva
 				CentralisedBasedSegmentNetwork() = delete;
 
 				CentralisedBasedSegmentNetwork(
-					const OptimisationInput &optinput) : _optinput(optinput), _chargingStrategy(FixAtEndChargingStrategy(optinput)) {};
+					const OptimisationInput &optinput) : _optinput(optinput), _chargingStrategy(FixAtEndChargingStrategy(optinput)), _nr_threads(optinput.get_config().get_const_nr_threads()) {};
 
 				// PUBLIC FUNCTIONS:
 
@@ -267,6 +268,8 @@ namespace eva
 				// INLINE 
 
 				inline const uint32_t get_number_segments() const { return _segments.get_vec().size(); };
+				inline const uint32_t get_number_skipped_segments() const { return _segments.get_number_skipped(); };
+				inline void set_nr_threads(const uint32_t nr_threads) { _nr_threads = std::max(static_cast<uint32_t>(1), nr_threads); };
 				inline const uint32_t &get_number_nodes() const { return _indexNode; };
 				inline const uint32_t &get_number_arcs() const { return _indexArc; };
 			};
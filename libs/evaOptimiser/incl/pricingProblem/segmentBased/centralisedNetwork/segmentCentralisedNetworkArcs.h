@@ -14,12 +14,12 @@ namespace eva
         {
             class CenArcData
 			{
-				std::vector<Types::AccessType> _vecAccess;
+				VehicleBitset _vehicleAccess;
 				Types::Index _fromNode = Constants::BIG_INDEX;
 				Types::Index _toNode = Constants::BIG_INDEX;
 
-				inline void _reset_access(Types::AccessType val_access) { std::fill(_vecAccess.begin(), _vecAccess.end(), val_access); };
-				inline void _set_vehicle_access(const Types::Index &indexVehicle, Types::AccessType val_access) { _vecAccess[indexVehicle] = val_access; };
+				inline void _reset_access(Types::AccessType val_access) { _vehicleAccess.set_all(val_access == Types::AccessType::ALLOWED); };
+				inline void _set_vehicle_access(const Types::Index &indexVehicle, Types::AccessType val_access) { _vehicleAccess.set(indexVehicle, val_access == Types::AccessType::ALLOWED); };
 
 			public:
 				CenArcData() {};
@@ -31,20 +31,20 @@ namespace eva
 					_fromNode(fromNode),
 					_toNode(toNode)
 				{
-					_vecAccess.resize(nrVehicles, Types::AccessType::ALLOWED);
+					_vehicleAccess.resize(nrVehicles, true);
 				}
 
 				Types::Index index = Constants::BIG_INDEX;
 
 				inline const Types::Index get_index() const { return index; };
 
-				inline const bool is_feasible() const { return std::any_of(_vecAccess.begin(), _vecAccess.end(), [](Types::AccessType val) { return val == Types::AccessType::ALLOWED; });};
+				inline const bool is_feasible() const { return _vehicleAccess.any(); };
 
-				inline void reset_default_fixings(const std::vector<Types::AccessType>& vecDefault) { _vecAccess = vecDefault; }
+				inline void reset_default_fixings(const VehicleBitset& defaultAccess) { _vehicleAccess = defaultAccess; }
 				inline void fix_vehicle(const Types::Index& indexVehicle) { _reset_access(Types::AccessType::NOT_ALLOWED); _set_vehicle_access(indexVehicle, Types::AccessType::ALLOWED);};
 				inline void revoke_access(const Types::Index& indexVehicle) { _set_vehicle_access(indexVehicle, Types::AccessType::NOT_ALLOWED);}
-				inline const bool has_access(const Types::Index &indexVehicle) const { return _vecAccess[indexVehicle] == Types::AccessType::ALLOWED; };
-				inline const std::vector<Types::AccessType>& get_vecAccess() const { return _vecAccess; };
+				inline const bool has_access(const Types::Index &indexVehicle) const { return _vehicleAccess.test(indexVehicle); };
+				inline const VehicleBitset& get_vehicleAccess() const { return _vehicleAccess; };
 				inline void fix_infeasible() { _reset_access(Types::AccessType::NOT_ALLOWED);}
 				
 			
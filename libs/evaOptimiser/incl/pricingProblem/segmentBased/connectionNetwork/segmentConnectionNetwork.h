@@ -6,10 +6,10 @@
 
 #include "segmentConnectionNetworkNodes.h"
 #include "segmentConnectionNetworkArcs.h"
+#include "pricingProblem/labelling/labelSetting.h"
 
 #include <boost/config.hpp>
 #include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/r_c_shortest_paths.hpp>
 
 namespace eva
 {
@@ -115,6 +115,12 @@ namespace eva
 				};
 			};
 
+			struct ConnectionBasedLabelKey
+			{
+				// A label can only be dominated by labels with a smaller or equal reduced cost:
+				inline double operator()(const ConnectionBasedResourceContainer &res_cont) const { return res_cont.reducedCost; };
+			};
+
 			class ConnectionBasedResourceExtensionFunction
 			{
 			private:
@@ -158,40 +164,21 @@ namespace eva
 																		  pareto_optimal_solutions(std::vector<std::vector<BoostConnectionBasedArc>>({std::vector<BoostConnectionBasedArc>()})) {};
 			};
 
-			class ConnectionBasedResourceExtensionVisitor : public boost::default_r_c_shortest_paths_visitor
+			class ConnectionBasedResourceExtensionVisitor : public labelling::DefaultLabelSettingVisitor
 			{
-				int32_t _max_labels = 50;
-				int32_t _ctr_labels_sink = 0;
-				bool _solve_optimal = false;
 				std::chrono::high_resolution_clock::time_point _timeOutClock;
 
 			public:
 				// Constructor
 				ConnectionBasedResourceExtensionVisitor() = delete;
 				ConnectionBasedResourceExtensionVisitor(
-					const uint32_t &max_labels,
-					const bool solve_optimal,
-					const std::chrono::high_resolution_clock::time_point &timeOutClock) : _max_labels(max_labels),
-												_solve_optimal(solve_optimal), _timeOutClock(timeOutClock)  {};
+					const std::chrono::high_resolution_clock::time_point& timeOutClock) : _timeOutClock(timeOutClock) {};
 
 				template <class Queue, class Graph>
-				bool on_enter_loop(const Queue &queue, const Graph &graph)
+				bool on_enter_loop(const Queue & /*queue*/, const Graph & /*graph*/)
 				{
-					// Stop entering the loop because the limit has been reached.
-					// It only counts processed labels. There can exist more labels at the sink node that just haven't been processed yet.
-					// This makes the labelling stop when at least _max_labels have been determined.
-
-					// If the pricing problem should be solved to optimality, always allow to enter the loop:
-					return (_solve_optimal || _ctr_labels_sink < _max_labels) && std::chrono::high_resolution_clock::now() < _timeOutClock; // Stops, if the number of qualifying labels has reached the maximum.
-				}
-
-				template <class Label, class Graph>
-				void on_label_feasible(Label &l, const Graph &g)
-				{
-					if (l.cumulated_resource_consumption.isEndSchedule)
-					{
-						++_ctr_labels_sink;
-					}
+					// The labelling only stops early at the time-out. The heuristic pricing bounds the label setting instead, which keeps the labels with the best reduced cost at every vertex:
+					return std::chrono::high_resolution_clock::now() < _timeOutClock;
 				}
 			};
 
@@ -208,24 +195,35 @@ namespace eva
 				const OptimisationInput &_optinput;
 				FixAtEndChargingStrategy _chargingStrategy;
 				Segments _segments;
+				uint32_t _nr_threads; // Threads used to update the segments and to build the network in parallel.
 
 				BoostConnectionBasedNetwork _boostSegmentNetwork;
 				std::vector<BoostConnectionBasedNode> _vecVehicleStartNodes;
 				std::vector<std::vector<BoostConnectionBasedNode>> _vecIncludesTripNodes;
 				std::vector<std::vector<BoostConnectionBasedNode>> _vecIncludesMaintenanceNodes;
 				std::map<Types::Index, std::vector<BoostConnectionBasedNode>> _mapIncludesScheduleNode;
-				std::vector<std::vector<std::vector<std::vector<BoostConnectionBasedNode>>>> _vecSortedNodesChargerToCharger;
+				std::vector<std::vector<std::vector<Types::Index>>> _vecSegmentsChargerToCharger;
+				std::vector<std::vector<BoostConnectionBasedNode>> _vecSortedSegmentNodes;
+				std::vector<uint8_t> _vecSegmentChanged;
+				std::vector<BoostConnectionBasedNode> _vecTopologicalOrder;
 
 				BoostConnectionBasedNode _endNode;
 
 				Types::Index _indexNode{0};
 				Types::Index _indexArc{0};
+				uint32_t _nrRetiredNodes = 0;
+				bool _flag_rebuild_required = true;
 
 				// PRIVATE FUNCTIONS
 
 				void _clearNetwork();
+				void _updateSegments(const BranchNode &brn, const Duals &duals);
 				void _addNodes(const BranchNode &brn, const Duals &duals);
+				void _addSegmentNodes(const Types::Index &indexSegment);
+				void _retireSegmentNodes(const Types::Index &indexSegment);
+				void _updateLookUps();
 				void _addArcs(const BranchNode &brn, const Duals &duals);
+				void _updateArcs(const BranchNode &brn, const Duals &duals, const Types::Index &indexFirstNewNode);
 				void _addBranches(const BranchNode &brn, const Duals &duals);
 				
 				BoostConnectionBasedNode _addNode(ConNodeData &nodeData);
@@ -233,8 +231,8 @@ namespace eva
 				BoostConnectionBasedArc _addArc(const BoostConnectionBasedNode fromNode, const BoostConnectionBasedNode toNode);
 
 				FullConArcData _createArcData(const BoostConnectionBasedNode fromNode, const BoostConnectionBasedNode toNode, const Duals &duals);
+				std::vector<FullConArcData> _createOutgoingArcs(const BoostConnectionBasedNode fromNode, const Duals &duals);
 
-				const bool _isDominated(std::vector<FullConArcData> &vecDominatingArcs, const FullConArcData &candidateArc);
 				const bool _isFeasible(const BoostConnectionBasedNode fromNode, const BoostConnectionBasedNode toNode);
 
 				Types::Index _getNextIndexNode() { return _indexNode++; }
@@ -253,7 +251,7 @@ namespace eva
 				ConnectionBasedSegmentNetwork() = delete;
 
 				ConnectionBasedSegmentNetwork(
-					const OptimisationInput &optinput) : _optinput(optinput), _chargingStrategy(FixAtEndChargingStrategy(optinput)) {};
+					const OptimisationInput &optinput) : _optinput(optinput), _chargingStrategy(FixAtEndChargingStrategy(optinput)), _nr_threads(optinput.get_config().get_const_nr_threads()) {};
 
 				// PUBLIC FUNCTIONS:
 
@@ -264,8 +262,10 @@ namespace eva
 				void update_branch_node_fixings(const BranchNode &brn);
 
 				inline const uint32_t get_number_segments() const { return _segments.get_vec().size(); };
-				inline const uint32_t &get_number_nodes() const { return _indexNode; };
-				inline const uint32_t &get_number_arcs() const { return _indexArc; };
+				inline const uint32_t get_number_skipped_segments() const { return _segments.get_number_skipped(); };
+				inline void set_nr_threads(const uint32_t nr_threads) { _nr_threads = std::max(static_cast<uint32_t>(1), nr_threads); };
+				inline const uint32_t get_number_nodes() const { return _indexNode - _nrRetiredNodes; };
+				inline const uint32_t get_number_arcs() const { return boost::num_edges(_boostSegmentNetwork); };
 			};
 		}
 
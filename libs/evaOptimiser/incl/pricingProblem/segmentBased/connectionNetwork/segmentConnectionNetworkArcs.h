@@ -2,10 +2,16 @@
 #define EVA_SEGMENT_CONNECTION_NETWORK_ARCS_H
 
 #include "evaConstants.h"
+#include "evaExceptions.h"
 #include "moderator/OptimisationInput.h"
 
 #include <boost/dynamic_bitset.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <vector>
+
 namespace eva
 {
 	namespace sbn
@@ -14,11 +20,11 @@ namespace eva
 		{
 			class ConArcData
 			{
-				std::vector<Types::AccessType> _vecAccess;
+				VehicleBitset _vehicleAccess;
 				Types::Index _indexFixedVehicle = Constants::BIG_INDEX;
 
-				inline void _reset_access(Types::AccessType val_access) { std::fill(_vecAccess.begin(), _vecAccess.end(), val_access); };
-				inline void _set_vehicle_access(const Types::Index &indexVehicle, Types::AccessType val_access) { _vecAccess[indexVehicle] = val_access; };
+				inline void _reset_access(Types::AccessType val_access) { _vehicleAccess.set_all(val_access == Types::AccessType::ALLOWED); };
+				inline void _set_vehicle_access(const Types::Index &indexVehicle, Types::AccessType val_access) { _vehicleAccess.set(indexVehicle, val_access == Types::AccessType::ALLOWED); };
 
 			public:
 				ConArcData() {};
@@ -26,7 +32,7 @@ namespace eva
 					const uint32_t &nrVehicles
 				)
 				{
-					_vecAccess.resize(nrVehicles, Types::AccessType::ALLOWED);
+					_vehicleAccess.resize(nrVehicles, true);
 				}
 
 				Types::Index index = Constants::BIG_INDEX;
@@ -34,13 +40,14 @@ namespace eva
 				Types::Index toNode = Constants::BIG_INDEX;
 
 				inline const Types::Index get_index() const { return index; };
-				inline const bool is_feasible() const { return std::any_of(_vecAccess.begin(), _vecAccess.end(), [](Types::AccessType val) { return val == Types::AccessType::ALLOWED; });};
+				inline const bool is_feasible() const { return _vehicleAccess.any(); };
 
-				inline void reset_default_fixings(const std::vector<Types::AccessType>& vecDefault) { _vecAccess = vecDefault; _indexFixedVehicle = Constants::BIG_INDEX;}
+				inline void reset_default_fixings(const VehicleBitset& defaultAccess) { _vehicleAccess = defaultAccess; _indexFixedVehicle = Constants::BIG_INDEX;}
 				inline void fix_vehicle(const Types::Index& indexVehicle) { _indexFixedVehicle = indexVehicle; _reset_access(Types::AccessType::NOT_ALLOWED); _set_vehicle_access(indexVehicle, Types::AccessType::ALLOWED);};
 				inline void revoke_access(const Types::Index& indexVehicle) { _set_vehicle_access(indexVehicle, Types::AccessType::NOT_ALLOWED);}
-				inline const bool has_access(const Types::Index &indexVehicle) const { return _vecAccess[indexVehicle] == Types::AccessType::ALLOWED; };
-				inline const std::vector<Types::AccessType>& get_vecAccess() const { return _vecAccess; };
+				inline void intersect_access(const VehicleBitset& access) { _vehicleAccess &= access; };
+				inline const bool has_access(const Types::Index &indexVehicle) const { return _vehicleAccess.test(indexVehicle); };
+				inline const VehicleBitset& get_vehicleAccess() const { return _vehicleAccess; };
 				inline const Types::Index& get_indexFixedVehicle() const { return _indexFixedVehicle;};
 			};
 
@@ -65,7 +72,7 @@ namespace eva
 				inline const bool dominates(const FullConArcData &dominatedArc) const
 				{
 					// Either both are NA, or both are fixed to the same vehicle. Otherwise, no dominance can be featured:
-					if(Helper::compare_is_subset(get_vecAccess(), dominatedArc.get_vecAccess())
+					if(Helper::compare_is_subset(get_vehicleAccess(), dominatedArc.get_vehicleAccess())
 						&& get_indexFixedVehicle() == dominatedArc.get_indexFixedVehicle())
 					{
 						return chargingDuration >= dominatedArc.chargingDuration
@@ -79,6 +86,63 @@ namespace eva
 				};
 			};
 
+			class ConArcSkyline
+			{
+				// Pareto skyline of the arcs from one node into the nodes of one segment.
+				// The arcs must be inserted by non-decreasing sink end time. An arc can then only be dominated by arcs in the skyline,
+				// and can itself only dominate the arcs in the skyline with the same sink end time, which are at the back.
+
+				std::vector<FullConArcData> _vecArcs;
+
+				// Bounds over the skyline arcs, used to skip the dominance check. The bounds are not lowered if arcs are removed:
+				int64_t _maxChargingDuration = std::numeric_limits<int64_t>::min();
+				double _maxWorstCaseDuals = std::numeric_limits<double>::lowest();
+
+			public:
+				// CONSTRUCTORS
+				ConArcSkyline() {};
+
+				// FUNCTIONS
+
+				inline void insert(const FullConArcData &candidateArc)
+				{
+#ifdef DEBUG_BUILD
+					if (!_vecArcs.empty() && _vecArcs.back().sinkEndTime > candidateArc.sinkEndTime)
+						throw LogicError("eva::sbn::con::ConArcSkyline::insert", "Arcs not sorted by sink end time!");
+#endif // DEBUG_BUILD
+
+					// a. Check if the new arc is dominated. No arc in the skyline can dominate the candidate,
+					// if the candidate has a longer charging duration or better best-case duals than all of them:
+					if (candidateArc.chargingDuration <= _maxChargingDuration
+						&& Helper::compare_floats_smaller_equal(candidateArc.accDuals + candidateArc.maxChargingDuals, _maxWorstCaseDuals))
+					{
+						for (const FullConArcData &skylineArc : _vecArcs)
+						{
+							if (skylineArc.dominates(candidateArc))
+								return;
+						}
+					}
+
+					// b. Remove the arcs with the same sink end time that are dominated by the new arc:
+					auto iterSameEndTime = _vecArcs.end();
+					while (iterSameEndTime != _vecArcs.begin() && std::prev(iterSameEndTime)->sinkEndTime == candidateArc.sinkEndTime)
+						--iterSameEndTime;
+
+					_vecArcs.erase(
+						std::remove_if(iterSameEndTime, _vecArcs.end(), [&](const FullConArcData &skylineArc)
+									   { return candidateArc.dominates(skylineArc); }),
+						_vecArcs.end());
+
+					_vecArcs.push_back(candidateArc);
+					_maxChargingDuration = std::max(_maxChargingDuration, candidateArc.chargingDuration);
+					_maxWorstCaseDuals = std::max(_maxWorstCaseDuals, candidateArc.accDuals + candidateArc.minChargingDuals);
+				};
+
+				// GETTERS
+
+				inline const std::vector<FullConArcData> &get_vecArcs() const { return _vecArcs; };
+			};
+
 		}
 	}
 }
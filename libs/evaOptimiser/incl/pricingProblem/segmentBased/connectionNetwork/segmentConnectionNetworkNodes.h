@@ -241,7 +241,7 @@ namespace eva
 
 			class ConNodeData
 			{
-				std::vector<Types::AccessType> _vecAccess;
+				VehicleBitset _vehicleAccess;
 				Types::Index _index_fixed_vehicle = Constants::BIG_INDEX;
 				Types::DateTime _max_rc_start_time = 0;
 				bool _flag_outgoing_to_sink_allowed = true;
@@ -253,51 +253,51 @@ namespace eva
 
 				// CONSTRUCTORS
 
-				ConNodeData() : index(Constants::BIG_INDEX),
-										 type(ConNodeType::UNDEFINED),
-										 ptrNodeData(std::make_unique<UndefinedNodeData>()) {};
+				ConNodeData() : ptrNodeData(std::make_unique<UndefinedNodeData>()),
+										 index(Constants::BIG_INDEX),
+										 type(ConNodeType::UNDEFINED) {};
 
 				ConNodeData(
 					const SegmentPieceNodeData &spnd,
-					const uint32_t &nrVehicles) : type(ConNodeType::SEGMENT),
-												  ptrNodeData(std::make_unique<SegmentPieceNodeData>(spnd))
+					const uint32_t &nrVehicles) : ptrNodeData(std::make_unique<SegmentPieceNodeData>(spnd)),
+												  type(ConNodeType::SEGMENT)
 				{
-					_vecAccess.resize(nrVehicles, Types::AccessType::ALLOWED);
+					_vehicleAccess.resize(nrVehicles, true);
 				};
 
 				ConNodeData(
 					const StartScheduleNodeData &vsnd,
-					const uint32_t &nrVehicles) : type(ConNodeType::START_SCHEDULE),
-												  ptrNodeData(std::make_unique<StartScheduleNodeData>(vsnd))
+					const uint32_t &nrVehicles) : ptrNodeData(std::make_unique<StartScheduleNodeData>(vsnd)),
+												  type(ConNodeType::START_SCHEDULE)
 				{
-					_vecAccess.resize(nrVehicles, Types::AccessType::ALLOWED);
+					_vehicleAccess.resize(nrVehicles, true);
 				};
 
 				ConNodeData(
 					const FixedChargingNodeData& fcnd,
-					const uint32_t &nrVehicles) : type(ConNodeType::FIXED_CHARGING),
-												  ptrNodeData(std::make_unique<FixedChargingNodeData>(fcnd))
+					const uint32_t &nrVehicles) : ptrNodeData(std::make_unique<FixedChargingNodeData>(fcnd)),
+												  type(ConNodeType::FIXED_CHARGING)
 				{
-					_vecAccess.resize(nrVehicles, Types::AccessType::ALLOWED);
+					_vehicleAccess.resize(nrVehicles, true);
 				};
 
 				ConNodeData(
 					const EndScheduleNodeData &vend,
-					const uint32_t &nrVehicles) : type(ConNodeType::END_SCHEDULE),
-												  ptrNodeData(std::make_unique<EndScheduleNodeData>(vend))
+					const uint32_t &nrVehicles) : ptrNodeData(std::make_unique<EndScheduleNodeData>(vend)),
+												  type(ConNodeType::END_SCHEDULE)
 				{
-					_vecAccess.resize(nrVehicles, Types::AccessType::ALLOWED);
+					_vehicleAccess.resize(nrVehicles, true);
 				};
 
 				// COPY CONSTRUCTORS:
 
-				ConNodeData(ConNodeData const &other) : index(other.index),
-																		  type(other.type),
-																		  ptrNodeData(other.ptrNodeData->clone()),
-																		  _vecAccess(other._vecAccess),
+				ConNodeData(ConNodeData const &other) : _vehicleAccess(other._vehicleAccess),
 																		  _index_fixed_vehicle(other._index_fixed_vehicle),
 																		  _max_rc_start_time(other._max_rc_start_time),
-																		  _flag_outgoing_to_sink_allowed(other._flag_outgoing_to_sink_allowed)
+																		  _flag_outgoing_to_sink_allowed(other._flag_outgoing_to_sink_allowed),
+																		  ptrNodeData(other.ptrNodeData->clone()),
+																		  index(other.index),
+																		  type(other.type)
 				{
 				}
 				ConNodeData(ConNodeData &&other) = default;
@@ -306,7 +306,7 @@ namespace eva
 					ptrNodeData = other.ptrNodeData->clone();
 					index = other.index;
 					type = other.type;
-					_vecAccess = other._vecAccess;
+					_vehicleAccess = other._vehicleAccess;
 					_index_fixed_vehicle = other._index_fixed_vehicle;
 					_max_rc_start_time = other._max_rc_start_time;
 					_flag_outgoing_to_sink_allowed = other._flag_outgoing_to_sink_allowed;
@@ -337,17 +337,17 @@ namespace eva
 				inline const double get_cost(const uint32_t &prev_distance) const { return ptrNodeData->get_cost(prev_distance); };
 				inline const double get_accDuals() const { return ptrNodeData->get_accDuals(); };
 
-				inline void init_access(const std::vector<Types::AccessType>& vecDefault) { _vecAccess = vecDefault;}
-				inline void set_access_all(const Types::AccessType val_access) { std::fill(_vecAccess.begin(), _vecAccess.end(), val_access);};
-				inline void set_access_vehicle(const Types::Index& indexVehicle, const Types::AccessType val_access) { _vecAccess[indexVehicle] = val_access;};
+				inline void init_access(const VehicleBitset& defaultAccess) { _vehicleAccess = defaultAccess;}
+				inline void set_access_all(const Types::AccessType val_access) { _vehicleAccess.set_all(val_access == Types::AccessType::ALLOWED);};
+				inline void set_access_vehicle(const Types::Index& indexVehicle, const Types::AccessType val_access) { _vehicleAccess.set(indexVehicle, val_access == Types::AccessType::ALLOWED);};
 				inline void fix_vehicle(const Types::Index& indexVehicle, const Types::DateTime& max_rc_start_time) { _index_fixed_vehicle = indexVehicle; _max_rc_start_time = max_rc_start_time;};
 				inline void set_flag_outgoing_to_sink_allowed(bool flag) { _flag_outgoing_to_sink_allowed = flag;};
 
 				inline const Types::DateTime& get_max_rc_start_time() const { return _max_rc_start_time;};
 				inline const Types::Index& get_indexFixedVehicle() const { return _index_fixed_vehicle;};
 				inline const bool get_has_fixed_activity(const Types::Index& indexVehicle) const { return _index_fixed_vehicle == indexVehicle;}
-				inline const std::vector<Types::AccessType>& get_vecAccess() const { return _vecAccess;};
-				inline const bool has_access(const Types::Index &indexVehicle) const { return _vecAccess[indexVehicle] == Types::AccessType::ALLOWED; };
+				inline const VehicleBitset& get_vehicleAccess() const { return _vehicleAccess;};
+				inline const bool has_access(const Types::Index &indexVehicle) const { return _vehicleAccess.test(indexVehicle); };
 				inline const bool is_flag_outgoing_to_sink_allowed() const { return _flag_outgoing_to_sink_allowed;};
 
 				inline const SegmentPieceNodeData *castSegmentPieceNodeData() const { return static_cast<const SegmentPieceNodeData *>(ptrNodeData.get()); };
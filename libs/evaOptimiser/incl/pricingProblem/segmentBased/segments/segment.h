@@ -87,7 +87,7 @@ namespace eva
 			uint32_t _maxub_rechargeDuration = 0;
 			uint32_t _maxub_fullPresenceAtCharger = 0;
 
-			std::vector<Types::AccessType> _vecFeasibleVehicle;
+			VehicleBitset _feasibleVehicles;
 
 			// PRIVATE FUNCTIONS:
 
@@ -118,8 +118,9 @@ namespace eva
 
 			// PUBLIC FUNCTIONS
 			
-			inline void updateNonDominatedSchedulePieces(const BranchNode& brn, const Duals& duals) { _subgraph.updateCurrentNonDominatedSchedulePieces(brn, duals); };
+			inline bool updateNonDominatedSchedulePieces(const BranchNode& brn, const Duals& duals) { return _subgraph.updateCurrentNonDominatedSchedulePieces(brn, duals); };
 			inline void updateVehicleFixings(const BranchNode& brn) { _subgraph.updateFixings(brn);};
+			inline const bool get_flag_skipped_last_update() const { return _subgraph.get_flag_skipped_last_update(); };
 
 			// GETTERS:
 
@@ -136,7 +137,7 @@ namespace eva
 			inline const uint32_t& get_distanceAfterMaintenance() const { return _distanceAfterMaintenance; };
 			inline const uint32_t get_total_distance() const { return _distanceBeforeMaintenance + _distanceAfterMaintenance;};
 			inline const bool get_hasMaintenance() const { return _hasMaintenance; };
-			inline const bool get_isVehicleFeasible(const Types::Index& indexVehicle) const { return _vecFeasibleVehicle[indexVehicle] == Types::AccessType::ALLOWED; };
+			inline const bool get_isVehicleFeasible(const Types::Index& indexVehicle) const { return _feasibleVehicles.test(indexVehicle); };
 
 			inline const uint32_t& get_minlb_rechargeDuration() const { return _minlb_rechargeDuration; };
 			inline const uint32_t& get_maxub_rechargeDuration() const { return _maxub_rechargeDuration; };
@@ -4,10 +4,28 @@
 #include "moderator/OptimisationInput.h"
 #include "segment.h"
 
+#include <algorithm>
+
 namespace eva
 {
 	namespace sbn
 	{
+		struct SegmentChainNode
+		{
+			// Node of the prefix trie of activity chains. The chain of a node is the chain of its parent, extended by its activity:
+			Types::Index indexParent = Constants::BIG_INDEX;
+			Types::Index indexActivity = Constants::BIG_INDEX;
+		};
+
+		struct SegmentChainTrie
+		{
+			// All feasible activity chains from one start charger, sharing their prefixes:
+			std::vector<SegmentChainNode> vecNodes;
+
+			// For every end charger, the trie nodes of the chains that can return to it, in enumeration order:
+			std::vector<std::vector<Types::Index>> vecEndChargerChains;
+		};
+
 		class Segments
 		{
 			// MEMBERS
@@ -18,17 +36,29 @@ namespace eva
 
 			// PRIVATE FUNCTIONS
 
-			void _createSegments(const OptimisationInput& optinput);
-			void _recursionGenerateSegments(
+			void _createSegments(const OptimisationInput& optinput, const uint32_t nr_threads);
+			void _buildChainTrie(
+				const OptimisationInput& optinput,
+				const std::vector<SegmentActivity>& vecAllActivities,
+				const Charger& startCharger,
+				const uint32_t& range,
+				SegmentChainTrie& trie
+			) const;
+			void _recursionExtendChain(
 				const OptimisationInput& optinput,
-				const std::vector<SegmentActivity>& vecAllActivities, 
-				const Charger& startCharger, 
-				const Charger& endCharger, 
-				const uint32_t& range, 
-				const Location curLocation, 
+				const std::vector<SegmentActivity>& vecAllActivities,
+				const uint32_t& range,
+				const Types::Index& curLocationIndex,
 				const uint32_t distance,
-				std::vector<SegmentActivity> vecThisSegmentActivities
-			);
+				const bool hasMaintenance,
+				const Types::Index& indexTrieNode,
+				SegmentChainTrie& trie
+			) const;
+			std::vector<SegmentActivity> _getChainActivities(
+				const std::vector<SegmentActivity>& vecAllActivities,
+				const SegmentChainTrie& trie,
+				Types::Index indexTrieNode
+			) const;
 
 			inline Types::Index _getNextIndex() { return _ctrIndex++; }
 
@@ -38,13 +68,14 @@ namespace eva
 
 			// PUBLIC FUNCTIONS:
 
-			void initialise(const OptimisationInput& _optinput);
+			void initialise(const OptimisationInput& _optinput, const uint32_t nr_threads);
 			
 
 			// GETTERS:
 
 			inline const std::vector<Segment>& get_vec() const { return _vecSegments; };
 			inline std::vector<Segment>& get_vec() { return _vecSegments; };
+			inline const uint32_t get_number_skipped() const { return std::count_if(_vecSegments.begin(), _vecSegments.end(), [](const Segment& segment) { return segment.get_flag_skipped_last_update(); }); };
 		};
 	}
 }
@@ -37,7 +37,7 @@ namespace eva
 				Types::DateTime _endTime = Constants::MAX_TIMESTAMP;
 				Types::Index _indexFixedVehicle = Constants::BIG_INDEX;
 
-				std::vector<Types::AccessType> _vecVehicleAccess;
+				VehicleBitset _vehicleAccess;
 				std::vector<Types::Index> _vecTripIndexes;
 				std::vector<Types::Index> _vecMaintenanceIndexes;
 				std::vector<Types::Index> _vecScheduleNodeIndexes;
@@ -53,7 +53,7 @@ namespace eva
 					const double& maxChargingDuals,
 					const Types::DateTime& startTime,
 					const Types::DateTime& endTime,
-					const std::vector<Types::AccessType>& vecVehicleAccess,
+					const VehicleBitset& vehicleAccess,
 					const std::vector<Types::Index>& vecTripIndexes,
 					const std::vector<Types::Index>& vecMaintenanceIndexes,
 					const std::vector<Types::Index>& vecScheduleNodeIndexes,
@@ -64,11 +64,11 @@ namespace eva
 					_maxChargingDuals(maxChargingDuals),
 					_startTime(startTime),
 					_endTime(endTime),
+					_indexFixedVehicle(indexFixedVehicle),
+					_vehicleAccess(vehicleAccess),
 					_vecTripIndexes(vecTripIndexes),
-					_vecVehicleAccess(vecVehicleAccess),
 					_vecMaintenanceIndexes(vecMaintenanceIndexes),
-					_vecScheduleNodeIndexes(vecScheduleNodeIndexes),
-					_indexFixedVehicle(indexFixedVehicle)
+					_vecScheduleNodeIndexes(vecScheduleNodeIndexes)
 				{}
 
 				inline const double& get_accDuals() const { return _accDuals; };
@@ -78,11 +78,24 @@ namespace eva
 				inline const Types::DateTime& get_startTime() const { return _startTime; };
 				inline const Types::DateTime& get_endTime() const { return _endTime; };
 
-				inline const std::vector<Types::AccessType>& get_vecVehicleAccess() const { return _vecVehicleAccess; };
+				inline const VehicleBitset& get_vehicleAccess() const { return _vehicleAccess; };
 				inline const std::vector<Types::Index>& get_vecTripIndexes() const { return _vecTripIndexes; };
 				inline const std::vector<Types::Index>& get_vecMaintenanceIndexes() const { return _vecMaintenanceIndexes; };
 				inline const std::vector<Types::Index>& get_vecScheduleNodeIndexes() const { return _vecScheduleNodeIndexes; };
 				inline const Types::Index& get_indexFixedVehicle() const { return _indexFixedVehicle;};
+
+				inline bool operator==(const NonDominatedSchedulePiece& other) const
+				{
+					// Exact comparison on purpose: an unchanged piece must reproduce the previous labelling result identically.
+					return _accDuals == other._accDuals
+						&& _minChargingDuals == other._minChargingDuals
+						&& _maxChargingDuals == other._maxChargingDuals
+						&& _startTime == other._startTime
+						&& _endTime == other._endTime
+						&& _indexFixedVehicle == other._indexFixedVehicle
+						&& _vehicleAccess == other._vehicleAccess
+						&& _vecScheduleNodeIndexes == other._vecScheduleNodeIndexes;
+				};
 			};
 
 			class SegmentSubGraph
@@ -96,8 +109,9 @@ namespace eva
 				Types::Index _indexArc{ 0 };
 
 				std::vector<std::vector<BoostSubGraphNode>> _vecLayers;
+				std::vector<BoostSubGraphNode> _vecTopologicalOrder;
 				std::vector<NonDominatedSchedulePiece> _vecCurrentNonDominatedSchedulePieces;
-				std::vector<Types::AccessType> _vecDefaultVehicleAccess;
+				VehicleBitset _defaultVehicleAccess;
 
 				BoostSubGraphNode _sourceNode;
 				BoostSubGraphNode _sinkNode;
@@ -108,8 +122,14 @@ namespace eva
 				std::unordered_map<Types::Index, std::vector<BoostSubGraphNode>> _mapScheduleNodeLookUp;
 				std::unordered_map<BoostSubGraphNode, Types::Index> _mapLayerLookUp;
 
+				// The duals of all nodes at the last labelling. The labelling is skipped, if neither these duals nor the fixings have changed:
+				std::vector<double> _vecDualFingerprint;
+				bool _flag_fixings_changed = true;
+				bool _flag_skipped_last_update = false;
+
 				// FUNCTIONS
 				void _updateDuals(const Duals& duals);
+				bool _updateDualFingerprint();
 
 				Types::Index _getNextIndexNode() { return _indexNode++; }
 				Types::Index _getNextIndexArc() { return _indexArc++; }
@@ -130,19 +150,20 @@ namespace eva
 
 				void initialise(const uint32_t& nrLayers);
 				void initialiseChargingDurationBounds(const uint32_t& lb, const uint32_t& ub) { _minlb_rechargeDuration = lb;  _maxub_rechargeDuration = ub; };
-				void initialiseInitialVehicleAccess(const std::vector<Types::AccessType>& vecInitialVehicleAccess) { _vecDefaultVehicleAccess = vecInitialVehicleAccess;};
+				void initialiseInitialVehicleAccess(const VehicleBitset& initialVehicleAccess) { _defaultVehicleAccess = initialVehicleAccess;};
 
 				void addTripNode(const SubScheduleTripNodeData& trip, const uint32_t& layer);
 				void addMaintenanceNode(const SubScheduleMaintenanceNodeData& maintenance, const uint32_t& layer);
 				void addAuxiliaryNodes(const Charger& startCharger, const Charger& endCharger);
 				void addConnections();
 
-				void updateCurrentNonDominatedSchedulePieces(const BranchNode& brn, const Duals& duals);
+				bool updateCurrentNonDominatedSchedulePieces(const BranchNode& brn, const Duals& duals);
 				void updateFixings(const BranchNode& brn);
 
 				// GETTERS:
 
 				inline const std::vector<NonDominatedSchedulePiece>& get_vecCurrentNonDominatedSchedulePieces() const { return _vecCurrentNonDominatedSchedulePieces; };
+				inline const bool get_flag_skipped_last_update() const { return _flag_skipped_last_update; };
 			};
 
 			struct SubGraphResourceContainer
@@ -154,7 +175,7 @@ namespace eva
 				double maxChargingDuals = 0.0;
 				Types::DateTime timestampEnd = Constants::MAX_TIMESTAMP;
 				Types::DateTime timestampStart = Constants::MAX_TIMESTAMP;
-				std::vector<Types::AccessType> vecAccess;
+				VehicleBitset vehicleAccess;
 				Types::Index indexFixedVehicle = Constants::BIG_INDEX;
 				Types::DateTime fixedAllowedEndTime = Constants::MAX_TIMESTAMP;
 				bool isFeasible = true;
@@ -169,7 +190,7 @@ namespace eva
 					const double& maxChargingDuals,
 					const Types::DateTime& timestampEnd,
 					const Types::DateTime& timestampStart,
-					const std::vector<Types::AccessType>& vecAccess,
+					const VehicleBitset& vehicleAccess,
 					const Types::Index indexFixedVehicle,
 					const Types::DateTime& fixedAllowedEndTime
 				) :
@@ -178,11 +199,13 @@ namespace eva
 					maxChargingDuals(maxChargingDuals),
 					timestampEnd(timestampEnd),
 					timestampStart(timestampStart),
-					vecAccess(vecAccess),
+					vehicleAccess(vehicleAccess),
 					indexFixedVehicle(indexFixedVehicle),
 					fixedAllowedEndTime(fixedAllowedEndTime)
 				{}
 
+				SubGraphResourceContainer(const SubGraphResourceContainer& other) = default;
+
 				~SubGraphResourceContainer() {}
 
 				SubGraphResourceContainer& operator=(const SubGraphResourceContainer& other);
@@ -202,7 +225,7 @@ namespace eva
 					// must be "<=" here!!!
 					// must NOT be "<"!!!
 
-					if (Helper::compare_is_subset(res_cont_1.vecAccess, res_cont_2.vecAccess))
+					if (Helper::compare_is_subset(res_cont_1.vehicleAccess, res_cont_2.vehicleAccess))
 					{
 						if (res_cont_1.timestampStart == res_cont_2.timestampStart)
 							return Helper::compare_floats_smaller_equal(res_cont_2.accDuals, res_cont_1.accDuals) && res_cont_1.timestampEnd <= res_cont_2.timestampEnd;
@@ -214,6 +237,12 @@ namespace eva
 				};
 			};
 
+			struct SubGraphLabelKey
+			{
+				// A label can only be dominated by labels that do not end later:
+				inline double operator()(const SubGraphResourceContainer& res_cont) const { return static_cast<double>(res_cont.timestampEnd); };
+			};
+
 			struct SubGraphResourceExtensionFunction
 			{
 				bool operator()(
@@ -249,13 +249,13 @@ namespace eva
 
 			class NodeData
 			{
-				std::vector<Types::AccessType> _vecAccess;
+				VehicleBitset _vehicleAccess;
 				Types::Index _indexFixedVehicle = Constants::BIG_INDEX;
 				Types::DateTime _fixedPathEndTime = Constants::MAX_TIMESTAMP;
 				Types::DateTime _fixedPathStartTime = Constants::MAX_TIMESTAMP;
 
-				inline void _reset_access(Types::AccessType val_access) { std::fill(_vecAccess.begin(), _vecAccess.end(), val_access); };
-				inline void _set_vehicle_access(const Types::Index& indexVehicle, Types::AccessType val_access) { _vecAccess[indexVehicle] = val_access;};
+				inline void _reset_access(Types::AccessType val_access) { _vehicleAccess.set_all(val_access == Types::AccessType::ALLOWED); };
+				inline void _set_vehicle_access(const Types::Index& indexVehicle, Types::AccessType val_access) { _vehicleAccess.set(indexVehicle, val_access == Types::AccessType::ALLOWED);};
 
 			public:
 				// ATTRIBUTES:
@@ -270,96 +270,96 @@ namespace eva
 				// CONSTRUCTORS
 
 				NodeData() :
+					ptrNodeData(std::make_unique<UndefinedNodeData>()),
 					index(Constants::BIG_INDEX),
-					type(NodeType::UNDEFINED),
-					ptrNodeData(std::make_unique<UndefinedNodeData>())
+					type(NodeType::UNDEFINED)
 				{};
 
 				NodeData(
 					const Types::Index index,
 					const size_t nrVehicles,
 					const TripNodeData& tnd,
-					const std::vector<Types::AccessType>& vecDefault
+					const VehicleBitset& defaultAccess
 				) :
-					index(index),
-					type(NodeType::TRIP),
+					_vehicleAccess(defaultAccess),
 					ptrNodeData(std::make_unique<TripNodeData>(tnd)),
-					_vecAccess(vecDefault)
+					index(index),
+					type(NodeType::TRIP)
 				{};
 
 				NodeData(
 					const Types::Index index,
 					const size_t nrVehicles,
 					const MaintenanceNodeData& mnd,
-					const std::vector<Types::AccessType>& vecDefault
+					const VehicleBitset& defaultAccess
 				) :
-					index(index),
-					type(NodeType::MAINTENANCE),
+					_vehicleAccess(defaultAccess),
 					ptrNodeData(std::make_unique<MaintenanceNodeData>(mnd)),
-					_vecAccess(vecDefault)
+					index(index),
+					type(NodeType::MAINTENANCE)
 				{};
 
 				NodeData(
 					const Types::Index index,
 					const size_t nrVehicles,
 					const StartSegmentNodeData& ss,
-					const std::vector<Types::AccessType>& vecDefault
+					const VehicleBitset& defaultAccess
 				) :
-					index(index),
-					type(NodeType::START_SEGMENT),
+					_vehicleAccess(defaultAccess),
 					ptrNodeData(std::make_unique<StartSegmentNodeData>(ss)),
-					_vecAccess(vecDefault)
+					index(index),
+					type(NodeType::START_SEGMENT)
 				{};
 
 				NodeData(
 					const Types::Index index,
 					const size_t nrVehicles,
 					const EndSegmentNodeData& ss,
-					const std::vector<Types::AccessType>& vecDefault
+					const VehicleBitset& defaultAccess
 				) :
-					index(index),
-					type(NodeType::END_SEGMENT),
+					_vehicleAccess(defaultAccess),
 					ptrNodeData(std::make_unique<EndSegmentNodeData>(ss)),
-					_vecAccess(vecDefault)
+					index(index),
+					type(NodeType::END_SEGMENT)
 				{};
 
 				NodeData(
 					const Types::Index index,
 					const size_t nrVehicles,
 					const CollectiveEndSegmentNodeData& ss,
-					const std::vector<Types::AccessType>& vecDefault
+					const VehicleBitset& defaultAccess
 				) :
-					index(index),
-					type(NodeType::COLLECTIVE_END_SEGMENT),
+					_vehicleAccess(defaultAccess),
 					ptrNodeData(std::make_unique<CollectiveEndSegmentNodeData>(ss)),
-					_vecAccess(vecDefault)
+					index(index),
+					type(NodeType::COLLECTIVE_END_SEGMENT)
 				{};
 
 				NodeData(
 					const Types::Index index,
 					const size_t nrVehicles,
 					const CollectiveStartSegmentNodeData& ss,
-					const std::vector<Types::AccessType>& vecDefault
+					const VehicleBitset& defaultAccess
 				) :
-					index(index),
-					type(NodeType::COLLECTIVE_START_SEGMENT),
+					_vehicleAccess(defaultAccess),
 					ptrNodeData(std::make_unique<CollectiveStartSegmentNodeData>(ss)),
-					_vecAccess(vecDefault)
+					index(index),
+					type(NodeType::COLLECTIVE_START_SEGMENT)
 				{};
 
 				// COPY CONSTRUCTORS:
 
 				NodeData(NodeData const& other) :
+					_vehicleAccess(other._vehicleAccess),
+					_indexFixedVehicle(other._indexFixedVehicle),
+					_fixedPathEndTime(other._fixedPathEndTime),
+					_fixedPathStartTime(other._fixedPathStartTime),
+					ptrNodeData(other.ptrNodeData->clone()),
 					index(other.index),
 					type(other.type),
-					ptrNodeData(other.ptrNodeData->clone()),
 					acc_dual(other.acc_dual),
 					min_charging_dual(other.min_charging_dual),
-					max_charging_dual(other.max_charging_dual),
-				 	_vecAccess(other._vecAccess),
-					_indexFixedVehicle(other._indexFixedVehicle),
-					_fixedPathEndTime(other._fixedPathEndTime),
-					_fixedPathStartTime(other._fixedPathStartTime)
+					max_charging_dual(other.max_charging_dual)
 				{}
 				NodeData(NodeData&& other) = default;
 				NodeData& operator=(NodeData const& other) {
@@ -369,7 +369,7 @@ namespace eva
 					acc_dual = other.acc_dual;
 					min_charging_dual = other.min_charging_dual;
 					max_charging_dual = other.max_charging_dual;
-					_vecAccess = other._vecAccess;
+					_vehicleAccess = other._vehicleAccess;
 					_indexFixedVehicle = other._indexFixedVehicle;
 					_fixedPathEndTime = other._fixedPathEndTime;
 					_fixedPathStartTime = other._fixedPathStartTime;
@@ -392,7 +392,7 @@ namespace eva
 				inline const Types::Index get_index() const { return index; };
 				inline const NodeType get_type() const { return type; };
 
-				inline void reset_default_fixings(const std::vector<Types::AccessType>& vecDefault) { _vecAccess = vecDefault; _indexFixedVehicle = Constants::BIG_INDEX; }
+				inline void reset_default_fixings(const VehicleBitset& defaultAccess) { _vehicleAccess = defaultAccess; _indexFixedVehicle = Constants::BIG_INDEX; }
 				inline void fix_infeasible() { _reset_access(Types::AccessType::NOT_ALLOWED); _indexFixedVehicle = Constants::BIG_INDEX; };
 				inline void fix_vehicle(const Types::Index& indexVehicle) { _indexFixedVehicle = indexVehicle; _reset_access(Types::AccessType::NOT_ALLOWED); _set_vehicle_access(indexVehicle, Types::AccessType::ALLOWED);};
 				inline void revoke_access(const Types::Index& indexVehicle) { _set_vehicle_access(indexVehicle, Types::AccessType::NOT_ALLOWED);}
@@ -401,9 +401,9 @@ namespace eva
 				inline void set_fixedPathEndTime(const Types::DateTime& timestamp) { _fixedPathEndTime = timestamp; };
 				inline void set_fixedPathStartTime(const Types::DateTime& timestamp) { _fixedPathStartTime = timestamp; };
 
-				inline const bool is_feasible() const { return std::any_of(_vecAccess.begin(), _vecAccess.end(), [](Types::AccessType val) { return val == Types::AccessType::ALLOWED; });};
-				inline const bool has_access(const Types::Index& indexVehicle) const { return _vecAccess[indexVehicle] == Types::AccessType::ALLOWED; };
-				inline const std::vector<Types::AccessType>& get_vecAccess() const { return _vecAccess; };
+				inline const bool is_feasible() const { return _vehicleAccess.any(); };
+				inline const bool has_access(const Types::Index& indexVehicle) const { return _vehicleAccess.test(indexVehicle); };
+				inline const VehicleBitset& get_vehicleAccess() const { return _vehicleAccess; };
 				inline const Types::Index& get_indexFixedVehicle() const { return _indexFixedVehicle;};
 
 				inline const TripNodeData* castTripNodeData() const { return static_cast<const TripNodeData*>(ptrNodeData.get()); };
@@ -14,7 +14,7 @@ namespace eva
 			uint32_t _duration = Constants::BIG_INTEGER;
 			uint32_t _distance = Constants::BIG_INTEGER;
 			double _cost = Constants::BIG_DOUBLE;
-			std::vector<Types::AccessType> _vecAccess;
+			VehicleBitset _vehicleAccess;
 
 		public:
 			// ATTRIBUTES
@@ -37,13 +37,15 @@ namespace eva
 				_cost(cost)
 			{}
 
-			inline void init_access(const size_t numberVehicles, Types::AccessType val_access) { _vecAccess.resize(numberVehicles, val_access); }
-			inline void set_access(const Types::Index& indexVehicle, Types::AccessType val_access) { _vecAccess[indexVehicle] = val_access; };
-			inline void reset_access(Types::AccessType val_access) { std::fill(_vecAccess.begin(), _vecAccess.end(), val_access); };
+			inline void init_access(const size_t numberVehicles, Types::AccessType val_access) { _vehicleAccess.resize(numberVehicles, val_access == Types::AccessType::ALLOWED); }
+			inline void set_access(const Types::Index& indexVehicle, Types::AccessType val_access) { _vehicleAccess.set(indexVehicle, val_access == Types::AccessType::ALLOWED); };
+			inline void reset_access(Types::AccessType val_access) { _vehicleAccess.set_all(val_access == Types::AccessType::ALLOWED); };
+			inline void set_vehicleAccess(const VehicleBitset& vehicleAccess) { _vehicleAccess = vehicleAccess; };
 
 			// GETTERS
 
-			inline const bool has_access(const Types::Index& indexVehicle) const { return _vecAccess[indexVehicle] == Types::AccessType::ALLOWED; };
+			inline const bool has_access(const Types::Index& indexVehicle) const { return _vehicleAccess.test(indexVehicle); };
+			inline const VehicleBitset& get_vehicleAccess() const { return _vehicleAccess; };
 			inline const Types::Index& get_index() const { return index; };
 			inline const uint32_t& get_duration() const { return _duration; };
 			inline const uint32_t& get_distance() const { return _distance; };
@@ -9,10 +9,10 @@
 
 #include "timeSpaceNodes.h"
 #include "timeSpaceArcs.h"
+#include "pricingProblem/labelling/labelSetting.h"
 
 #include <boost/config.hpp>
 #include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/r_c_shortest_paths.hpp>
 
 namespace eva
 {
@@ -41,6 +41,7 @@ namespace eva
 			bool isEndSchedule = false;
 			Types::DateTime max_rc_start_time = Constants::MAX_TIMESTAMP;
 			bool isExemptFromDominance = false;
+			Types::Index indexChargingArrival = Constants::BIG_INDEX; // Put on charge slot at which the label entered the current charging chain.
 
 			// CONSTRUCTORS:
 
@@ -70,7 +71,8 @@ namespace eva
 														   soc(other.soc),
 														   isEndSchedule(other.isEndSchedule),
 														   max_rc_start_time(other.max_rc_start_time),
-														   isExemptFromDominance(other.isExemptFromDominance) {};
+														   isExemptFromDominance(other.isExemptFromDominance),
+														   indexChargingArrival(other.indexChargingArrival) {};
 
 			~TimeSpaceResourceContainer() {};
 
@@ -110,6 +112,9 @@ namespace eva
 				}
 				else if (res_cont_2.isExemptFromDominance)
 					return false;
+				else if (res_cont_1.indexChargingArrival != res_cont_2.indexChargingArrival)
+					// Within a charging chain, the charging session depends on the arrival slot:
+					return false;
 				else if (_include_distance)
 					return Helper::compare_floats_smaller_equal(res_cont_1.reducedCost, res_cont_2.reducedCost) && res_cont_1.soc >= res_cont_2.soc && res_cont_1.distanceLastMaintenance <= res_cont_2.distanceLastMaintenance;
 				else
@@ -117,6 +122,12 @@ namespace eva
 			};
 		};
 
+		struct TimeSpaceLabelKey
+		{
+			// A label can only be dominated by labels with a smaller or equal reduced cost:
+			inline double operator()(const TimeSpaceResourceContainer &res_cont) const { return res_cont.reducedCost; };
+		};
+
 		class TimeSpaceResourceExtensionFunction
 		{
 		private:
@@ -153,6 +164,10 @@ namespace eva
 				const TimeSpaceResourceContainer &old_cont,
 				const TimeSpaceChargingNodeData *chargingNodeData) const;
 
+			bool _handleChargingChainExit(
+				TimeSpaceResourceContainer &new_cont,
+				const TimeSpaceChargingChainNodeData *chargingChainNodeData) const;
+
 			bool operator()(
 				const BoostTimeSpaceNetwork &boostTimeSpaceNetwork,
 				TimeSpaceResourceContainer &new_cont,
@@ -174,42 +189,21 @@ namespace eva
 																		  pareto_optimal_solutions(std::vector<std::vector<BoostTimeSpaceArc>>({std::vector<BoostTimeSpaceArc>()})) {};
 		};
 
-		class TimeSpaceResourceExtensionVisitor : public boost::default_r_c_shortest_paths_visitor
+		class TimeSpaceResourceExtensionVisitor : public labelling::DefaultLabelSettingVisitor
 		{
-			int32_t _max_labels = 50;
-			int32_t _ctr_labels_sink = 0;
-			bool _solve_optimal = false;
 			std::chrono::high_resolution_clock::time_point _timeOutClock;
 
 		public:
 			// Constructor
 			TimeSpaceResourceExtensionVisitor() = delete;
 			TimeSpaceResourceExtensionVisitor(
-				const uint32_t &max_labels,
-				const bool solve_optimal,
-				const std::chrono::high_resolution_clock::time_point& timeOutClock) : 
-					_max_labels(max_labels),
-					_solve_optimal(solve_optimal),
-					_timeOutClock(timeOutClock) {};
+				const std::chrono::high_resolution_clock::time_point& timeOutClock) : _timeOutClock(timeOutClock) {};
 
 			template <class Queue, class Graph>
-			bool on_enter_loop(const Queue &queue, const Graph &graph)
-			{
-				// Stop entering the loop because the limit has been reached.
-				// It only counts processed labels. There can exist more labels at the sink node that just haven't been processed yet.
-				// This makes the labelling stop when at least _max_labels have been determined.
-
-				// If the pricing problem should be solved to optimality, always allow to enter the loop:
-				return (_solve_optimal || _ctr_labels_sink < _max_labels) && std::chrono::high_resolution_clock::now() < _timeOutClock; // Stops, if the number of qualifying labels has reached the maximum.
-			}
-
-			template <class Label, class Graph>
-			void on_label_feasible(Label &l, const Graph &g)
+			bool on_enter_loop(const Queue & /*queue*/, const Graph & /*graph*/)
 			{
-				if (l.cumulated_resource_consumption.isEndSchedule)
-				{
-					++_ctr_labels_sink;
-				}
+				// The labelling only stops early at the time-out. The heuristic pricing bounds the label setting instead, which keeps the labels with the best reduced cost at every vertex:
+				return std::chrono::high_resolution_clock::now() < _timeOutClock;
 			}
 		};
 
@@ -219,6 +213,28 @@ namespace eva
 				std::vector<BoostTimeSpaceNode> vec_fixed_nodes;
 			};
 
+		struct TimeSpaceNodeAccessRecord
+		{
+			BoostTimeSpaceNode node;
+			VehicleBitset access;
+			Types::Index indexFixedVehicle;
+			Types::DateTime maxRcStartTime;
+		};
+
+		struct TimeSpaceArcAccessRecord
+		{
+			BoostTimeSpaceArc arc;
+			VehicleBitset access;
+		};
+
+		struct TimeSpaceAppliedBranch
+		{
+			// A branch applied to the network, and the size of the undo logs before it was applied:
+			BranchKey key;
+			size_t sizeNodeLog = 0;
+			size_t sizeArcLog = 0;
+		};
+
 		class TimeSpaceNetwork
 		{
 			const OptimisationInput &_optinput;
@@ -234,9 +250,18 @@ namespace eva
 			std::vector<BoostTimeSpaceNode> _vecMaintenanceNodes;
 			std::vector<std::vector<std::vector<BoostTimeSpaceNode>>> _vecChargingNodesFrom;
 			std::vector<std::vector<std::vector<BoostTimeSpaceNode>>> _vecChargingNodesTo;
+			std::vector<std::vector<std::vector<BoostTimeSpaceArc>>> _vecChargingArcsFrom; // Arcs into the charging chain of a charger, per source node.
+			std::vector<std::vector<std::vector<BoostTimeSpaceArc>>> _vecChargingArcsTo; // Arcs out of the charging chain of a charger, per target node.
 			std::map<eva::BoostScheduleNode, BoostTimeSpaceNode> _mapScheduleNodeLookup;
+			std::vector<BoostTimeSpaceNode> _vecTopologicalOrder;
 			BoostTimeSpaceNode _endNode;
 
+			// Branches currently applied to the access of the network, and the undo logs to roll them back:
+			std::vector<TimeSpaceAppliedBranch> _vecAppliedBranches;
+			std::vector<TimeSpaceNodeAccessRecord> _vecNodeAccessLog;
+			std::vector<TimeSpaceArcAccessRecord> _vecArcAccessLog;
+			std::vector<std::vector<TimeSpaceNodeFixings>> _vecNodeFixings;
+
 			Types::Index _getNextIndexNode() { return _indexNode++; }
 			Types::Index _getNextIndexArc() { return _indexArc++; }
 
@@ -247,8 +272,13 @@ namespace eva
 			void _addVehicleStartEndNodes();
 			void _addDeadlegs();
 			void _addCharging();
+			void _addChargingChains();
 			void _initialiseNodeAccess();
-			void _resetAccess();
+			void _applyBranch(const BranchKey &key);
+			void _rollbackBranch();
+			void _updateMaxRcStartTimes(const Types::Index &indexVehicle);
+			void _logNodeAccess(const BoostTimeSpaceNode node);
+			void _logArcAccess(const BoostTimeSpaceArc arc);
 
 			// GETTERS
 			const BoostTimeSpaceNode &_getStartNode(const Types::Index &indexVehicle) const { return _vecStartNodes[indexVehicle]; };
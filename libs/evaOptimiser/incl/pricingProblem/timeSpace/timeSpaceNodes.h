@@ -14,6 +14,7 @@ namespace eva
 			TRIP = 1,
 			MAINTENANCE,
 			CHARGING,
+			CHARGING_CHAIN,
 			START_SCHEDULE,
 			CHARGER_END_SCHEDULE,
 			COLLECTIVE_END_SCHEDULE,
@@ -146,6 +147,44 @@ namespace eva
 		};
 
 
+		class TimeSpaceChargingChainNodeData : public TimeSpaceBaseNodeData
+		{
+			// ATTRIBUTES
+			// One time slot in the chain of a charger. A vehicle enters the chain at the earliest put on charge slot after its arrival,
+			// waits along the chain, and leaves it at the latest take off charge slot before its next activity.
+
+			const Charger& _charger;
+			const Types::Index _indexSlot;
+			const SubSchedulePutOnChargeNodeData& _putOnChargeNode;
+
+		public:
+			// CONSTRUCTORS
+
+			TimeSpaceChargingChainNodeData(
+				const Charger& charger,
+				const Types::Index& indexSlot,
+				const SubSchedulePutOnChargeNodeData& putOnChargeNode
+			) :
+				_charger(charger),
+				_indexSlot(indexSlot),
+				_putOnChargeNode(putOnChargeNode)
+			{}
+
+			// GETTERS
+
+			inline const Charger& get_charger() const { return _charger; };
+			inline const Types::Index& get_indexSlot() const { return _indexSlot; };
+
+			virtual inline const Types::Index get_startLocationIndex() const override { return _charger.get_location().get_index(); };
+			virtual inline const Types::Index get_endLocationIndex() const override { return _charger.get_location().get_index(); };
+			virtual inline const uint32_t get_distance() const override { return 0; };
+			virtual inline const Types::DateTime get_startTime() const override { return _putOnChargeNode.get_scheduleNodeData().get_startTime(); };
+			virtual inline const Types::DateTime get_endTime() const override { return _putOnChargeNode.get_scheduleNodeData().get_startTime(); };
+			virtual inline const Types::Index get_scheduleNodeIndex() const override { return Constants::BIG_INDEX; };
+		protected:
+			virtual TimeSpaceChargingChainNodeData* deepClone() const override { return new TimeSpaceChargingChainNodeData(*this); };
+		};
+
 		class TimeSpaceStartScheduleNodeData : public TimeSpaceBaseNodeData
 		{
 			// ATTRIBUTES
@@ -244,7 +283,7 @@ namespace eva
 			std::unique_ptr<TimeSpaceBaseNodeData> ptrNodeData;
 			Types::Index index;
 			TimeSpaceNodeType type;
-			std::vector<TimeSpaceNodeAccessType> access;
+			VehicleBitset access;
 
 			// CONSTRUCTORS
 
@@ -280,6 +319,15 @@ namespace eva
 				ptrNodeData(std::make_unique<TimeSpaceChargingNodeData>(cnd))
 			{}
 
+			TimeSpaceNodeData(
+				const Types::Index index,
+				const TimeSpaceChargingChainNodeData& ccnd
+			) :
+				index(index),
+				type(TimeSpaceNodeType::CHARGING_CHAIN),
+				ptrNodeData(std::make_unique<TimeSpaceChargingChainNodeData>(ccnd))
+			{}
+
 			TimeSpaceNodeData(
 				const Types::Index index,
 				const TimeSpaceStartScheduleNodeData& vsnd
@@ -333,16 +381,17 @@ namespace eva
 
 			~TimeSpaceNodeData() = default;
 
-			inline void init_access(const size_t numberVehicles, TimeSpaceNodeAccessType val_access) { access.resize(numberVehicles, val_access); }
-			inline void set_access(const Types::Index& indexVehicle, TimeSpaceNodeAccessType val_access) { access[indexVehicle] = val_access; };
-			inline void set_access(const Types::Index& indexVehicle, bool val_access) { access[indexVehicle] = static_cast<TimeSpaceNodeAccessType>(val_access); };
-			inline void reset_access(TimeSpaceNodeAccessType val_access) { std::fill(access.begin(), access.end(), val_access); };
-			inline void reset_access(bool val_access) { std::fill(access.begin(), access.end(), static_cast<TimeSpaceNodeAccessType>(val_access)); };
-			inline const bool is_accessible_all_vehicles() const { return std::find(access.begin(), access.end(), TimeSpaceNodeAccessType::NOT_ALLOWED) == access.end(); };
+			inline void init_access(const size_t numberVehicles, TimeSpaceNodeAccessType val_access) { access.resize(numberVehicles, val_access == TimeSpaceNodeAccessType::ALLOWED); }
+			inline void set_access(const Types::Index& indexVehicle, TimeSpaceNodeAccessType val_access) { access.set(indexVehicle, val_access == TimeSpaceNodeAccessType::ALLOWED); };
+			inline void set_access(const Types::Index& indexVehicle, bool val_access) { access.set(indexVehicle, val_access); };
+			inline void reset_access(TimeSpaceNodeAccessType val_access) { access.set_all(val_access == TimeSpaceNodeAccessType::ALLOWED); };
+			inline void reset_access(bool val_access) { access.set_all(val_access); };
+			inline const bool is_accessible_all_vehicles() const { return access.count() == access.size(); };
 
 			inline void reset_max_rc_start_time() { _index_fixed_vehicle = Constants::BIG_INDEX; _max_rc_start_time = 0;};
 			inline void set_max_rc_start_time(const Types::DateTime& max_rc_start_time, const Types::Index& indexVehicle) { _index_fixed_vehicle = indexVehicle; _max_rc_start_time = max_rc_start_time;};
 			inline const bool get_has_fixed_activity(const Types::Index& indexVehicle) const { return _index_fixed_vehicle == indexVehicle;}
+			inline const Types::Index& get_index_fixed_vehicle() const { return _index_fixed_vehicle; };
 			inline const Types::DateTime& get_max_rc_start_time() const { return _max_rc_start_time;};
 
 			inline const Types::Index get_scheduleNodeIndex() const { return ptrNodeData->get_scheduleNodeIndex(); };
@@ -355,13 +404,14 @@ namespace eva
 
 			inline const Types::Index& get_index() const { return index; };
 			inline const TimeSpaceNodeType get_type() const { return type; };
-			inline const bool has_access(const Types::Index& indexVehicle) const { return access[indexVehicle] == TimeSpaceNodeAccessType::ALLOWED; };
+			inline const bool has_access(const Types::Index& indexVehicle) const { return access.test(indexVehicle); };
 
 
 			// TODO: HERE ADD DEBUG / RELEASE VERSION OF CASTING THAT CHECK THE TYPE:
 			inline const TimeSpaceTripNodeData* castTripNodeData() const { return static_cast<const TimeSpaceTripNodeData*>(ptrNodeData.get()); };
 			inline const TimeSpaceMaintenanceNodeData* castMaintenanceNodeData() const { return static_cast<const TimeSpaceMaintenanceNodeData*>(ptrNodeData.get()); };
 			inline const TimeSpaceChargingNodeData* castChargingNodeData() const { return static_cast<const TimeSpaceChargingNodeData*>(ptrNodeData.get()); };
+			inline const TimeSpaceChargingChainNodeData* castChargingChainNodeData() const { return static_cast<const TimeSpaceChargingChainNodeData*>(ptrNodeData.get()); };
 			inline const TimeSpaceStartScheduleNodeData* castVehicleStartNodeData() const { return static_cast<const TimeSpaceStartScheduleNodeData*>(ptrNodeData.get()); };
 			inline const TimeSpaceCollectiveEndScheduleNodeData* castCollectiveVehicleEndNodeData() const { return static_cast<const TimeSpaceCollectiveEndScheduleNodeData*>(ptrNodeData.get()); };
 			inline const TimeSpaceChargerEndScheduleNodeData* castChargerVehicleEndNodeData() const { return static_cast<const TimeSpaceChargerEndScheduleNodeData*>(ptrNodeData.get()); };
@@ -0,0 +1,63 @@
+#ifndef EVA_VEHICLE_SELECTOR_H
+#define EVA_VEHICLE_SELECTOR_H
+
+#include "evaConstants.h"
+#include "moderator/OptimisationInput.h"
+#include "moderator/moderator.h"
+
+#include <random>
+#include <vector>
+
+namespace eva
+{
+	class VehicleSelector
+	{
+		// Orders the vehicles in rotation for the partial pricing, which prices the vehicles in batches until a batch yields a negative reduced cost schedule.
+		// The random policy shuffles the vehicles. The adaptive policy orders them by a score of their recent pricing success, and of the change of their relevant duals:
+		// the dual of the vehicle, the duals of the trips of its last improving schedules, and the duals of its start charger and of the chargers it used.
+		// In every batch, some vehicles are still drawn at random, such that vehicles with a low score are priced now and then.
+
+		const OptimisationInput& _optinput;
+		const bool _isAdaptive;
+		std::mt19937 _generator;
+
+		// SCORES:
+		std::vector<double> _vecSuccessRate; // Exponentially smoothed share of the pricing runs of the vehicle that found a negative reduced cost schedule.
+		std::vector<std::vector<Types::Index>> _vecRelevantTrips; // Per vehicle: trips of the schedules of its last improving pricing run.
+		std::vector<std::vector<Types::Index>> _vecRelevantChargers; // Per vehicle: chargers of the schedules of its last improving pricing run.
+
+		// DUALS OF THE PREVIOUS ORDERING:
+		Duals _previousDuals;
+		bool _hasPreviousDuals = false;
+
+		// HIT RATES:
+		uint64_t _nrVehiclesPriced = 0;
+		uint64_t _nrVehiclesImproving = 0;
+
+		// FUNCTION DEFINITIONS:
+
+		const Types::Index _getStartCharger(const Types::Index& indexVehicle) const;
+		std::vector<double> _getChargerDualChanges(const Duals& duals) const;
+		const double _getDualChange(const Types::Index& indexVehicle, const Duals& duals, const std::vector<double>& vecChargerDualChanges) const;
+
+	public:
+		VehicleSelector() = delete;
+		VehicleSelector(const OptimisationInput& optinput);
+
+		// FUNCTIONS:
+
+		// Returns the vehicles in rotation, in the order in which they are priced in batches of batchSize:
+		std::vector<Types::Index> get_orderedVehicles(const std::vector<uint8_t>& vecVehicleRotation, const Duals& duals, const uint32_t& batchSize);
+
+		// Updates the scores and the hit rates with the schedules found for the priced vehicles:
+		void record_pricing(const std::vector<Types::Index>& vecVehicleIndexes, const std::vector<std::vector<SubVehicleSchedule>>& resSchedule);
+
+		// INLINE GETTERS:
+
+		inline const char* get_policyName() const { return _isAdaptive ? "ADAPTIVE" : "RANDOM"; };
+		inline const uint64_t get_nrVehiclesPriced() const { return _nrVehiclesPriced; };
+		inline const uint64_t get_nrVehiclesImproving() const { return _nrVehiclesImproving; };
+	};
+}
+
+#endif // !EVA_VEHICLE_SELECTOR_H
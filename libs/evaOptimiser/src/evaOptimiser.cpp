@@ -3,6 +3,16 @@
 #include <iostream>
 #include <chrono>
 #include <queue>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <omp.h>
 
 #include "moderator/branch.h"
 #include "moderator/OptimisationInput.h"
@@ -49,6 +59,8 @@ namespace eva
 			stats_pd.mp_size_constraints = mp.get_sizeConstraints();
 			stats_pd.mp_size_variables = mp.get_sizeVariables();
 			stats_pd.pp_network_construction_ms = pp.get_network_construction_ms();
+			stats_pd.pp_vehicles_priced = pp.get_nrVehiclesPriced();
+			stats_pd.pp_vehicles_improving = pp.get_nrVehiclesImproving();
 			stats_pd.columnsAdded = 0;
 			stats_pd.lb_relaxed = -Constants::BIG_DOUBLE;
 			stats_pd.ub_relaxed = Constants::BIG_DOUBLE;
@@ -70,6 +82,8 @@ namespace eva
 				stats_pd.time_mpSolver = mp.get_totalRuntimeSolver(); // Init the runtime, to later adjust.
 				stats_pd.time_ppSolver = pp.get_totalRuntimeSolver(); // Init the runtime, to later adjust.
 				stats_pd.pp_network_construction_ms = pp.get_network_construction_ms();
+				stats_pd.pp_vehicles_priced = pp.get_nrVehiclesPriced();
+				stats_pd.pp_vehicles_improving = pp.get_nrVehiclesImproving();
 
 				// a. Solve the MP:
 				mp_solved = mp.solve();
@@ -102,8 +116,12 @@ namespace eva
 				stats_pd.time_ppSolver = pp.get_totalRuntimeSolver() - stats_pd.time_ppSolver;
 				stats_pd.columnsAdded = mpAddingVarsResult.columnsAdded;
 				stats_pd.pp_network_construction_ms = pp.get_network_construction_ms() - stats_pd.pp_network_construction_ms;
+				stats_pd.pp_vehicle_selection = pp.get_vehicleSelectionPolicy();
+				stats_pd.pp_vehicles_priced = pp.get_nrVehiclesPriced() - stats_pd.pp_vehicles_priced;
+				stats_pd.pp_vehicles_improving = pp.get_nrVehiclesImproving() - stats_pd.pp_vehicles_improving;
 				stats_pd.pp_network_size_nodes = pp.get_network_size_nodes();
 				stats_pd.pp_network_size_arcs = pp.get_network_size_arcs();
+				stats_pd.pp_segments_skipped = pp.get_number_skipped_segments();
 				stats_pd.mp_size_constraints = mp.get_sizeConstraints();
 				stats_pd.mp_size_variables = mp.get_sizeVariables();
 
@@ -233,11 +251,81 @@ namespace eva
 		// 	return true;
 		// };
 
+		static PricingProblemResult stabilised_pricing(OptimisationInput& optinput, const BranchNode& brn, MasterProblem& mp, PricingProblem& pp, DualStabilisation& stabilisation, const bool solve_all_pp_vehicles, double& cur_lb, Stats::PerformanceDetail& stats_pd, const std::chrono::high_resolution_clock::time_point& timeOutClock)
+		{
+			// Wentges smoothing with mis-pricing recovery:
+			// The pricing problem is solved with the separation duals. Only schedules with negative reduced cost under the current duals are kept.
+			// If none exist, it was a mis-pricing, and the separation point is moved closer to the current duals until the current duals are priced themselves.
+			PricingProblemResult pricingProblemResult;
+			LagrangianEvaluation lagrangianEval;
+			const Duals& duals = mp.get_currentDuals();
+			double alpha = 0.0;
+			bool hasNegReducedCost = false;
+
+			stats_pd.stabilisation_alpha = stabilisation.get_alpha();
+			stats_pd.stabilisation_misPricings = 0;
+
+			while (true)
+			{
+				alpha = stabilisation.get_misPricingAlpha(stats_pd.stabilisation_misPricings);
+				const Duals& separationDuals = Helper::compare_floats_smaller(0.0, alpha) ? stabilisation.update_separationDuals(duals, alpha) : duals;
+
+				pricingProblemResult = pp.find_neg_reduced_cost_schedule(separationDuals, brn, true, false, solve_all_pp_vehicles, timeOutClock);
+
+				// Evaluate the lagrangian function at the separation point. It is only a valid bound if the pricing problem was solved to optimality:
+				lagrangianEval = mp.evaluate_lagrangian(separationDuals, stabilisation.has_center() ? stabilisation.update_direction(duals) : duals, pricingProblemResult.resSchedule);
+				if (pricingProblemResult.isOptimal)
+				{
+					cur_lb = std::max(cur_lb, lagrangianEval.lb);
+					stats_pd.lb_lagrangian = std::max(stats_pd.lb_lagrangian, lagrangianEval.lb);
+				}
+
+				// Check the schedules against the current duals, and remove the ones that do not improve the RMP:
+				hasNegReducedCost = false;
+				for (auto& vecSchedules : pricingProblemResult.resSchedule)
+				{
+					for (auto& schedule : vecSchedules)
+						schedule.reducedCost = schedule.get_current_reducedCost(duals);
+
+					vecSchedules.erase(std::remove_if(vecSchedules.begin(), vecSchedules.end(),
+						[](const SubVehicleSchedule& schedule) { return !Helper::compare_floats_smaller(schedule.reducedCost, 0.0); }), vecSchedules.end());
+
+					hasNegReducedCost = hasNegReducedCost || !vecSchedules.empty();
+				}
+
+				// Update the stability center, if the bound improved:
+				stabilisation.update_center(separationDuals, pricingProblemResult.isOptimal ? lagrangianEval.lb : -Constants::BIG_DOUBLE);
+
+				if (hasNegReducedCost)
+				{
+					if (stabilisation.has_center())
+						stabilisation.update_alpha(lagrangianEval.subgradientProduct);
+					break;
+				}
+
+				// Either the current duals have been priced, or it was a mis-pricing:
+				if (!Helper::compare_floats_smaller(0.0, alpha))
+					break;
+
+				// A mis-pricing at the time-out leaves the current duals unpriced. Hence, the empty result must not be taken as optimal:
+				if (std::chrono::high_resolution_clock::now() >= timeOutClock)
+				{
+					pricingProblemResult.isOptimal = false;
+					break;
+				}
+
+				++stats_pd.stabilisation_misPricings;
+			}
+
+			return pricingProblemResult;
+		};
+
 		static ColumnGenerationResults column_generation(OptimisationInput& optinput, const BranchNode& brn, MasterProblem& mp, PricingProblem& pp, Solution& solution, const double& lb_integer, bool is_root, const double& convergence_acceptance,const std::chrono::high_resolution_clock::time_point& timeOutClockPH)
 		{
 			// 0. Initialisation:
 			bool keep_iterating = false;
 			bool mp_solved = false, mp_charger_capacity_feasible = false;;
+			bool pruned_by_bound = false;
 			bool solve_all_pp_vehicles = false;
 			ColumnGenerationResults res;
 			
@@ -248,6 +336,7 @@ namespace eva
 			std::chrono::high_resolution_clock::time_point timeOutClock = std::min(std::chrono::high_resolution_clock::now() + std::chrono::seconds(optinput.get_config().get_const_column_generation_timelimit()), timeOutClockPH);
 			eva::PricingProblemResult pricingProblemResult;
 			eva::StatusVarSchedulesAdded mpAddingVarsResult;
+			DualStabilisation stabilisation(optinput);
 
 			// 0. Stats initialisation:
 			Stats::PerformanceDetail stats_pd;
@@ -259,6 +348,8 @@ namespace eva
 			stats_pd.mp_size_constraints = mp.get_sizeConstraints();
 			stats_pd.mp_size_variables = mp.get_sizeVariables();
 			stats_pd.pp_network_construction_ms = pp.get_network_construction_ms();
+			stats_pd.pp_vehicles_priced = pp.get_nrVehiclesPriced();
+			stats_pd.pp_vehicles_improving = pp.get_nrVehiclesImproving();
 			stats_pd.columnsAdded = 0;
 			stats_pd.iteration = 0;
 
@@ -284,8 +375,12 @@ namespace eva
 			stats_pd.time_mpSolver = mp.get_totalRuntimeSolver() - stats_pd.time_mpSolver;
 			stats_pd.time_ppSolver = pp.get_totalRuntimeSolver() - stats_pd.time_ppSolver;
 			stats_pd.pp_network_construction_ms = pp.get_network_construction_ms() - stats_pd.pp_network_construction_ms;
+			stats_pd.pp_vehicle_selection = pp.get_vehicleSelectionPolicy();
+			stats_pd.pp_vehicles_priced = pp.get_nrVehiclesPriced() - stats_pd.pp_vehicles_priced;
+			stats_pd.pp_vehicles_improving = pp.get_nrVehiclesImproving() - stats_pd.pp_vehicles_improving;
 			stats_pd.pp_network_size_nodes = pp.get_network_size_nodes();
 			stats_pd.pp_network_size_arcs = pp.get_network_size_arcs();
+			stats_pd.pp_segments_skipped = pp.get_number_skipped_segments();
 			stats_pd.ub_integer = solution.objective;
 
 			if (mp.get_currentSolutionStatus() == MasterProblemSolutionStatus::MP_INTEGER 
@@ -315,8 +410,13 @@ namespace eva
 				stats_pd.time_mpSolver = mp.get_totalRuntimeSolver(); // Init the runtime, to later adjust.
 				stats_pd.time_ppSolver = pp.get_totalRuntimeSolver(); // Init the runtime, to later adjust.
 				stats_pd.pp_network_construction_ms = pp.get_network_construction_ms();
+				stats_pd.pp_vehicles_priced = pp.get_nrVehiclesPriced();
+				stats_pd.pp_vehicles_improving = pp.get_nrVehiclesImproving();
+				stats_pd.stabilisation_alpha = 0.0;
+				stats_pd.stabilisation_misPricings = 0;
+				stats_pd.lb_lagrangian = -Constants::BIG_DOUBLE;
+				stats_pd.early_termination = NULL;
 
-				
 				// Check for some flags in this iteration:
 				// OR if the restricted master problem is currently bigger than the best solution objective
 				// because, if the rmp has a weaker lower bound, it can be immediately pruned. 
@@ -331,8 +431,27 @@ namespace eva
 				if (mpAddingVarsResult.columnsAdded <= 0)
 				{
 					// 1. Solve the pricing problem:
-					pricingProblemResult = pp.find_neg_reduced_cost_schedule(mp.get_currentDuals(), brn, true, false, solve_all_pp_vehicles,timeOutClock);
-					mpAddingVarsResult = mp.addVarsSchedule(pricingProblemResult.resSchedule, true);
+					if (optinput.get_config().get_flag_dual_stabilisation())
+					{
+						pricingProblemResult = stabilised_pricing(optinput, brn, mp, pp, stabilisation, solve_all_pp_vehicles, cur_lb, stats_pd, timeOutClock);
+						mpAddingVarsResult = mp.addVarsSchedule(pricingProblemResult.resSchedule, true);
+					}
+					else
+					{
+						pricingProblemResult = pp.find_neg_reduced_cost_schedule(mp.get_currentDuals(), brn, true, false, solve_all_pp_vehicles,timeOutClock);
+						mpAddingVarsResult = mp.addVarsSchedule(pricingProblemResult.resSchedule, true);
+
+						if(pricingProblemResult.isOptimal)
+						{
+							cur_lb = mpAddingVarsResult.lb;
+							stats_pd.lb_lagrangian = mpAddingVarsResult.lb;
+						}
+					}
+
+					// If all objective coefficients are integer, so is the objective of every integer solution. Hence, the lower bound can be rounded up.
+					// The integrality follows from the cost configuration, and the columns of this phase are added with their cost:
+					if (optinput.get_config().get_flag_lagrangian_termination() && mp.has_integer_objective(true))
+						cur_lb = std::ceil(cur_lb - Constants::EPS);
 #ifdef DEBUG_BUILD
 					// Check the added schedules:
 					for(const auto& vecSchedules: pricingProblemResult.resSchedule)
@@ -347,9 +466,6 @@ namespace eva
 						}
 					}
 #endif
-					
-					if(pricingProblemResult.isOptimal)
-						cur_lb = mpAddingVarsResult.lb;
 				}
 
 				// c. Resolve the master problem.
@@ -397,12 +513,22 @@ namespace eva
 
 				res.lb = std::max(cur_lb, res.lb);
 
+				// Terminate early, if the lower bound shows that the branch node cannot improve the incumbent.
+				// The node is pruned by its bound, hence the charger capacities do not have to be enforced anymore:
+				pruned_by_bound = optinput.get_config().get_flag_lagrangian_termination() && !is_root
+					&& !Helper::compare_floats_smaller(stats_pd.lb_relaxed, solution.objective);
+				if (pruned_by_bound)
+					stats_pd.early_termination = "LB_EXCEEDS_INCUMBENT";
+				else if (optinput.get_config().get_flag_lagrangian_termination() && !Helper::compare_floats_smaller(stats_pd.lb_relaxed, stats_pd.ub_relaxed))
+					stats_pd.early_termination = "LB_CLOSES_RMP_GAP";
+
 				// Important to note, the lb_relaxed may be higher than ub_relaxed.
 				// For instance, the parent node was solved to a feasible mp solution
 				// This node may be infeasible and there could be charger capacity violations
 				// Then, the ub_relaxed is smaller than lb_relaxed
 				// Regardless, the boolean will be false, and capacity constraints are subsequently added
-				keep_iterating = stats_pd.columnsAdded > 0
+				keep_iterating = !pruned_by_bound
+					&& stats_pd.columnsAdded > 0
 					&& Helper::compare_floats_smaller(stats_pd.lb_relaxed, stats_pd.ub_relaxed)
 					&& Helper::compare_floats_smaller(convergence_acceptance, stats_pd.gap_relaxed())
 					&& Helper::compare_floats_smaller(stats_pd.lb_relaxed, solution.objective);
@@ -411,7 +537,7 @@ namespace eva
 #endif
 
 				// e. Check if convergence-criteria is reached::
-				if (!keep_iterating)
+				if (!keep_iterating && !pruned_by_bound)
 				{
 					// If yes, check the charger capacity constraints:
 					mp_charger_capacity_feasible = mp.check_and_update_charger_capacity(true);
@@ -445,8 +571,12 @@ namespace eva
 				stats_pd.time_mpSolver = mp.get_totalRuntimeSolver() - stats_pd.time_mpSolver;
 				stats_pd.time_ppSolver = pp.get_totalRuntimeSolver() - stats_pd.time_ppSolver;
 				stats_pd.pp_network_construction_ms = pp.get_network_construction_ms() - stats_pd.pp_network_construction_ms;
+				stats_pd.pp_vehicle_selection = pp.get_vehicleSelectionPolicy();
+				stats_pd.pp_vehicles_priced = pp.get_nrVehiclesPriced() - stats_pd.pp_vehicles_priced;
+				stats_pd.pp_vehicles_improving = pp.get_nrVehiclesImproving() - stats_pd.pp_vehicles_improving;
 				stats_pd.pp_network_size_nodes = pp.get_network_size_nodes();
 				stats_pd.pp_network_size_arcs = pp.get_network_size_arcs();
+				stats_pd.pp_segments_skipped = pp.get_number_skipped_segments();
 				stats_pd.mp_size_constraints = mp.get_sizeConstraints();
 				stats_pd.mp_size_variables = mp.get_sizeVariables();
 				
@@ -457,7 +587,7 @@ namespace eva
 				std::cout << stats_pd.lb_relaxed << " / " << stats_pd.ub_relaxed << " / " << stats_pd.ub_integer << ", columns: " << stats_pd.columnsAdded << std::endl;
 #endif
 
-			} while (keep_iterating || !mp_charger_capacity_feasible); // g. Run the column generation until stopping criterium is reached & charger capacity constraints are all feasible.
+			} while (keep_iterating || (!mp_charger_capacity_feasible && !pruned_by_bound)); // g. Run the column generation until stopping criterium is reached & charger capacity constraints are all feasible.
 
 			// Store lower bound:
 			// only interested in the final lower bound.
@@ -637,7 +767,36 @@ namespace eva
 		}
 
 
-		static Branch get_strong_branch(OptimisationInput& optinput, BranchEvaluator& branchEval, MasterProblem& mp, PricingProblem& pp, Solution& sol, Stats::PlanningHorizon& stats_ph, const BranchNode& parentBranchNode, const std::chrono::high_resolution_clock::time_point& timeOutClockPH)
+		static double evaluate_strong_branch(OptimisationInput& optinput, MasterProblem& mp, PricingProblem& pp, Solution& sol, const Stats::PlanningHorizon& stats_ph, const BranchNode& parentBranchNode, const Branch& candidateBranch, const std::chrono::high_resolution_clock::time_point& timeOutClockPH)
+		{
+			// Solve column generation heuristically in both children of the candidate branch.
+			// The score is the smallest increase of the bound of both children, or BIG_DOUBLE if both children are infeasible:
+			Branch leftBranch = candidateBranch;
+			leftBranch.set_branchValue(std::floor(leftBranch.get_fractionalValue()));
+
+			Branch rightBranch = candidateBranch;
+			rightBranch.set_branchValue(std::ceil(rightBranch.get_fractionalValue()));
+
+			double cur_strong_branch_score = Constants::BIG_DOUBLE;
+			for (const Branch &newBranch : {leftBranch, rightBranch})
+			{
+				BranchNode childBranchNode(stats_ph.branchingTree_size, parentBranchNode, newBranch, optinput);
+				mp.filterVars(childBranchNode);
+				pp.updateNodeAccess(childBranchNode);
+
+				// Heuristic solve column generation, terminates early.
+				ColumnGenerationResults res_cg = column_generation(optinput, childBranchNode, mp, pp, sol, childBranchNode.get_lb(), false, optinput.get_config().get_const_linear_optimality_gap(),timeOutClockPH);
+
+				if (res_cg.isFeasible)
+				{
+					cur_strong_branch_score = std::min(cur_strong_branch_score, mp.get_currentObjective() - parentBranchNode.get_lb());
+				}
+			}
+
+			return cur_strong_branch_score;
+		};
+
+		static Branch get_strong_branch(OptimisationInput& optinput, BranchEvaluator& branchEval, MasterProblem& mp, PricingProblem& pp, std::deque<PricingProblem>& deqWorkerPricingProblems, std::deque<MasterProblem>& deqWorkerMasterProblems, Solution& sol, Stats::PlanningHorizon& stats_ph, const BranchNode& parentBranchNode, const std::chrono::high_resolution_clock::time_point& timeOutClockPH)
 		{
 			std::chrono::high_resolution_clock::time_point startClock = std::chrono::high_resolution_clock::now();
 			
@@ -721,56 +880,135 @@ namespace eva
 			Branch strongest_branch = pQ.top(); // Default top branch from first evaluation, in case no stronger branch exists.
 			double strongest_branch_score = 0.0; // maximise this score in the second evaluation:
 			int32_t ctr_second_evaluations = 0;
-			while(ctr_second_evaluations < optinput.get_config().get_const_max_number_second_tier_eval_strong_branching() && !pQ.empty())
-			{
-				candidateBranch = pQ.top();
-				pQ.pop();
 
-				// Check if the candidateBranch can beat the score of the currently strongest branch:
-				if (Helper::compare_floats_smaller(strongest_branch_score, candidateBranch.get_strong_branching_score()))
+			// In a parallel tree search, the workers already occupy all threads:
+			if (optinput.get_config().get_flag_parallel_strong_branching() && !optinput.get_config().get_flag_parallel_tree_search() && optinput.get_config().get_const_nr_threads() > 1)
+			{
+				// Evaluate the candidates in batches, one candidate per worker. Each worker has its own copy of the master problem, and its own pricing problem, which both run on the single thread of the worker.
+				// The copies are kept over the calls, and only receive the rows and columns that were added to the master problem since:
+				const uint32_t nr_workers = optinput.get_config().get_const_nr_threads();
+				while (deqWorkerPricingProblems.size() < nr_workers)
+					deqWorkerPricingProblems.emplace_back(optinput, 1);
+
+				for (MasterProblem& wmp : deqWorkerMasterProblems)
+					wmp.sync_with(mp);
+				while (deqWorkerMasterProblems.size() < nr_workers)
+					deqWorkerMasterProblems.emplace_back(mp);
+
+				std::vector<Branch> vecBatchBranches;
+				while (ctr_second_evaluations < optinput.get_config().get_const_max_number_second_tier_eval_strong_branching() && !pQ.empty())
 				{
-					leftBranch = candidateBranch;
-					leftBranch.set_branchValue(std::floor(leftBranch.get_fractionalValue()));
-
-					rightBranch = candidateBranch;
-					rightBranch.set_branchValue(std::ceil(rightBranch.get_fractionalValue()));
-
-					cur_strong_branch_score = Constants::BIG_DOUBLE;
-					for (const Branch &newBranch : {leftBranch, rightBranch})
+					// Take the candidates that can still beat the score of the currently strongest branch:
+					vecBatchBranches.clear();
+					while (vecBatchBranches.size() < nr_workers
+						&& ctr_second_evaluations + vecBatchBranches.size() < optinput.get_config().get_const_max_number_second_tier_eval_strong_branching()
+						&& !pQ.empty()
+						&& Helper::compare_floats_smaller(strongest_branch_score, pQ.top().get_strong_branching_score()))
 					{
-						BranchNode childBranchNode(stats_ph.branchingTree_size, parentBranchNode, newBranch, optinput);
-						mp.filterVars(childBranchNode);
-						pp.updateNodeAccess(childBranchNode);
+						vecBatchBranches.push_back(pQ.top());
+						pQ.pop();
+					}
 
-						// Heuristic solve column generation, terminates early.
-						ColumnGenerationResults res_cg = column_generation(optinput, childBranchNode, mp, pp, sol, childBranchNode.get_lb(), false, optinput.get_config().get_const_linear_optimality_gap(),timeOutClockPH);
+					if (vecBatchBranches.empty())
+						break; // No need to search longer, because the pQ is sorted. So all following branches won't be able to be better either.
 
-						if (res_cg.isFeasible)
+					std::vector<double> vecBatchScores(vecBatchBranches.size(), Constants::BIG_DOUBLE);
+					std::vector<Solution> vecBatchSolutions(vecBatchBranches.size(), sol);
+					std::exception_ptr exceptionPtr = nullptr;
+					const int32_t nrBatchBranches = static_cast<int32_t>(vecBatchBranches.size());
+
+#ifdef DEBUG_BUILD
+					omp_set_num_threads(1);
+#else
+					omp_set_num_threads(nr_workers);
+#endif // DEBUG_BUILD
+#pragma omp parallel for schedule(static, 1)
+					for (int32_t idxBatch = 0; idxBatch < nrBatchBranches; ++idxBatch)
+					{
+						try
 						{
-							cur_strong_branch_score = std::min(cur_strong_branch_score, mp.get_currentObjective() - parentBranchNode.get_lb());
+							vecBatchScores[idxBatch] = evaluate_strong_branch(optinput, deqWorkerMasterProblems[idxBatch], deqWorkerPricingProblems[idxBatch], vecBatchSolutions[idxBatch], stats_ph, parentBranchNode, vecBatchBranches[idxBatch], timeOutClockPH);
+						}
+						catch (...)
+						{
+#pragma omp critical
+							exceptionPtr = std::current_exception();
 						}
 					}
 
-					// Store the branch_score:
-					if(!Helper::compare_floats_equal(cur_strong_branch_score, Constants::BIG_DOUBLE))
+					if (exceptionPtr)
+						std::rethrow_exception(exceptionPtr);
+
+					// Merge the results of the workers:
+					for (Types::Index idxBatch = 0; idxBatch < vecBatchBranches.size(); ++idxBatch)
 					{
-						branchEval.update_branch_mean_score(candidateBranch);
+						if (Helper::compare_floats_smaller(vecBatchSolutions[idxBatch].objective, sol.objective))
+							sol = vecBatchSolutions[idxBatch];
+
+						// Store the branch_score:
+						if (!Helper::compare_floats_equal(vecBatchScores[idxBatch], Constants::BIG_DOUBLE))
+							branchEval.update_branch_mean_score(vecBatchBranches[idxBatch]);
+
+						// Compare with current strongest_branch_score, if score is bigger, pick the branch instead:
+						if (Helper::compare_floats_smaller(strongest_branch_score, vecBatchScores[idxBatch]))
+						{
+							strongest_branch_score = vecBatchScores[idxBatch];
+							strongest_branch = vecBatchBranches[idxBatch];
+						}
 					}
 
-					// Compare with current strongest_branch_score, if score is bigger, pick the branch instead:
-					if (Helper::compare_floats_smaller(strongest_branch_score, cur_strong_branch_score))
+					// Increase the counter of evaluations:
+					ctr_second_evaluations += vecBatchBranches.size();
+				}
+
+				// As in the serial evaluation, the columns generated by the workers remain available to the master problem. Duplicates among the workers are skipped:
+				std::unordered_map<size_t, std::vector<SubVehicleSchedule>> umapWorkerSchedules;
+				for (MasterProblem& wmp : deqWorkerMasterProblems)
+				{
+					for (SubVehicleSchedule& schedule : wmp.extract_unsynced_schedules())
 					{
-						strongest_branch_score = cur_strong_branch_score;
-						strongest_branch = candidateBranch;
+						std::vector<SubVehicleSchedule>& vecSameSignature = umapWorkerSchedules[schedule.signatureHash];
+						if (std::none_of(vecSameSignature.begin(), vecSameSignature.end(), [&](const SubVehicleSchedule& other) { return other.isIdenticalTo(schedule); }))
+						{
+							mp.store_schedule_in_pool(schedule);
+							vecSameSignature.push_back(std::move(schedule));
+						}
 					}
 				}
-				else
+			}
+			else
+			{
+				while(ctr_second_evaluations < optinput.get_config().get_const_max_number_second_tier_eval_strong_branching() && !pQ.empty())
 				{
-					break; // No need to search longer, because the pQ is sorted. So all following branches won't be able to be better either.
-				}
+					candidateBranch = pQ.top();
+					pQ.pop();
+
+					// Check if the candidateBranch can beat the score of the currently strongest branch:
+					if (Helper::compare_floats_smaller(strongest_branch_score, candidateBranch.get_strong_branching_score()))
+					{
+						cur_strong_branch_score = evaluate_strong_branch(optinput, mp, pp, sol, stats_ph, parentBranchNode, candidateBranch, timeOutClockPH);
 
-				// Increase the counter of evaluations:
-				++ctr_second_evaluations;
+						// Store the branch_score:
+						if(!Helper::compare_floats_equal(cur_strong_branch_score, Constants::BIG_DOUBLE))
+						{
+							branchEval.update_branch_mean_score(candidateBranch);
+						}
+
+						// Compare with current strongest_branch_score, if score is bigger, pick the branch instead:
+						if (Helper::compare_floats_smaller(strongest_branch_score, cur_strong_branch_score))
+						{
+							strongest_branch_score = cur_strong_branch_score;
+							strongest_branch = candidateBranch;
+						}
+					}
+					else
+					{
+						break; // No need to search longer, because the pQ is sorted. So all following branches won't be able to be better either.
+					}
+
+					// Increase the counter of evaluations:
+					++ctr_second_evaluations;
+				}
 			}
 
 			Stats::PerformanceDetail stats_pd;
@@ -782,27 +1020,399 @@ namespace eva
 			return strongest_branch;
 		};
 
+		static void filter_branch_node(OptimisationInput& optinput, MasterProblem& mp, PricingProblem& pp, const BranchNode& parentBranchNode, const BranchNode& childBranchNode, const Branch& newBranch)
+		{
+			// Store the branch details:
+			Stats::PerformanceDetail stats_pd;
+			stats_pd.indexPlanningHorizon = optinput.get_indexPlanningHorizon();
+			stats_pd.indexBranchingNode = childBranchNode.get_index();
+			stats_pd.indexParentBranchingNode = parentBranchNode.get_index();
+			stats_pd.fractionalValue = newBranch.get_fractionalValue();
+			stats_pd.branchValue = newBranch.get_branchValue();
+			stats_pd.branchType = newBranch.get_branchTypeName();
+
+			int indexFromScheduleNode = -1;
+			int indexToScheduleNode = -1;
+			int indexCharger = -1;
+			switch (newBranch.get_type())
+			{
+			case BranchType::TRIP_UNASSIGNED:
+				indexFromScheduleNode = newBranch.castBranchTripUnassigned()->get_subTripNodeData().get_scheduleNodeData().get_index();
+				indexToScheduleNode = newBranch.castBranchTripUnassigned()->get_subTripNodeData().get_scheduleNodeData().get_index();
+				indexCharger = -1;
+				break;
+			case BranchType::VEHICLE_CHARGING_AFTER:
+				stats_pd.VehicleId = newBranch.castBranchVehicleChargingAfter()->get_vehicle().get_id();
+				indexFromScheduleNode = newBranch.castBranchVehicleChargingAfter()->get_indexFromScheduleNode();
+				indexCharger = newBranch.castBranchVehicleChargingAfter()->get_charger().get_index();
+				break;
+			case BranchType::VEHICLE_CHARGING_BEFORE:
+				stats_pd.VehicleId = newBranch.castBranchVehicleChargingBefore()->get_vehicle().get_id();
+				indexToScheduleNode = newBranch.castBranchVehicleChargingBefore()->get_indexToScheduleNode();
+				indexCharger = newBranch.castBranchVehicleChargingBefore()->get_charger().get_index();
+				break;
+			case BranchType::VEHICLE_ROTATION:
+				stats_pd.VehicleId = newBranch.castBranchVehicleRotation()->get_vehicle().get_id();
+				break;
+			case BranchType::VEHICLE_TRIP:
+				stats_pd.TripId = newBranch.castBranchVehicleTrip()->get_subTripNodeData().get_ptrTripNodeData()->get_trip().get_id();
+				indexFromScheduleNode = newBranch.castBranchVehicleTrip()->get_subTripNodeData().get_scheduleNodeData().get_index();
+				indexToScheduleNode = newBranch.castBranchVehicleTrip()->get_subTripNodeData().get_scheduleNodeData().get_index();
+				indexCharger = -1;
+				stats_pd.VehicleId = newBranch.castBranchVehicleTrip()->get_vehicle().get_id();
+				break;
+			case BranchType::VEHICLE_MAINTENANCE:
+				stats_pd.MaintenanceId = newBranch.castBranchVehicleMaintenance()->get_subMaintenanceNodeData().get_ptrMaintenanceNodeData()->get_maintenance().get_id();
+				indexFromScheduleNode = newBranch.castBranchVehicleMaintenance()->get_subMaintenanceNodeData().get_scheduleNodeData().get_index();
+				indexToScheduleNode = newBranch.castBranchVehicleMaintenance()->get_subMaintenanceNodeData().get_scheduleNodeData().get_index();
+				indexCharger = 0;
+				stats_pd.VehicleId = newBranch.castBranchVehicleMaintenance()->get_vehicle().get_id();
+				break;
+			default:
+				break;
+			}
+
+			// Filter the variables:
+			stats_pd.time_mpFilterVars = mp.get_totalRuntimeFilterVars();
+			stats_pd.time_ppFilterNodes = pp.get_totalRuntimeFilterNodes();
+
+			mp.filterVars(childBranchNode);
+			pp.updateNodeAccess(childBranchNode);
+
+			stats_pd.time_mpFilterVars = mp.get_totalRuntimeFilterVars() - stats_pd.time_mpFilterVars;
+			stats_pd.time_ppFilterNodes = pp.get_totalRuntimeFilterNodes() - stats_pd.time_ppFilterNodes;
+
+			optinput.get_dataHandler().storeStatsPerformanceDetail(stats_pd);
+
+#ifdef DEBUG_BUILD
+			// Summarise the output:
+			auto tid = stats_pd.TripId != Constants::BIG_UINTEGER ? std::to_string(stats_pd.TripId) : "";
+			auto mid = stats_pd.MaintenanceId != Constants::BIG_UINTEGER ? std::to_string(stats_pd.MaintenanceId) : "";
+			auto vid = stats_pd.VehicleId != Constants::BIG_UINTEGER ? std::to_string(stats_pd.VehicleId) : "";
+			std::cout << stats_pd.branchType << ": " << stats_pd.fractionalValue << " -> " << stats_pd.branchValue << ", Vehicle: " << vid
+			 << ", Charger: " << indexCharger << ", From:  " << indexFromScheduleNode << ", To: " << indexToScheduleNode << std::endl;
+#endif
+		};
+
+		struct ParallelTreeSearch
+		{
+			// Shared state of the parallel best-first search. All members are guarded by the mutex:
+			std::mutex mutex;
+			std::condition_variable cv;
+			std::priority_queue<OpenBranchNode, std::vector<OpenBranchNode>, OpenBranchNode::CompareLb> pQ;
+			std::vector<double> vecWorkerLb; // Lower bound of the node a worker is currently solving, BIG_DOUBLE if idle.
+			uint32_t nr_active_workers = 0;
+			bool terminate = false;
+			Solution incumbent;
+
+			// Shared column pool, trimmed from the front. Each worker reads the pool from its own cursor:
+			std::mutex mutexPool;
+			std::deque<std::pair<uint32_t, SubVehicleSchedule>> deqColumnPool; // first: worker that generated the schedule.
+			size_t poolOffset = 0; // Absolute position of the front of the pool.
+			std::unordered_set<size_t> setSharedSignatures; // Signatures of all schedules shared so far, also after they are trimmed from the pool.
+
+			ParallelTreeSearch(const uint32_t nr_workers, const Solution& sol) :
+				vecWorkerLb(nr_workers, Constants::BIG_DOUBLE),
+				incumbent(sol)
+			{};
+
+			// The global lower bound is the smallest bound among all open and currently solved nodes:
+			const double get_lb() const
+			{
+				double lb = pQ.empty() ? incumbent.objective : std::min(incumbent.objective, pQ.top().lb);
+				for (const double& workerLb : vecWorkerLb)
+					lb = std::min(lb, workerLb);
+				return lb;
+			};
+		};
+
+		static void parallel_bestf_bnp(OptimisationInput& optinput, BranchEvaluator& branchEval, const std::chrono::high_resolution_clock::time_point& timeOutBnP, MasterProblem& mp, PricingProblem& pp, BranchNode& root_brn, Solution& sol, Stats::PlanningHorizon& stats_ph)
+		{
+			// N workers explore independent subtrees of the best-first search tree at the same time.
+			// Each worker has its own master and pricing problem, and shares the open nodes, the incumbent and the columns with positive value in its RMP.
+			// One worker per thread. Hence, the master and the pricing problem of each worker run serially:
+			const uint32_t nr_workers = optinput.get_config().get_const_nr_threads();
+			const uint32_t nr_threads_per_worker = 1;
+			const size_t max_pool_size = optinput.get_config().get_const_max_number_cols_mp_pool();
+
+			ParallelTreeSearch search(nr_workers, sol);
+			search.pQ.push(root_brn.get_openBranchNode(nullptr));
+
+			// Copy the master problem of the root node for each additional worker, before any worker starts:
+			std::deque<MasterProblem> deqWorkerMasterProblems;
+			for (uint32_t idxWorker = 1; idxWorker < nr_workers; ++idxWorker)
+				deqWorkerMasterProblems.emplace_back(mp);
+
+			// Each worker learns its own pseudo-costs, starting from the ones of the caller. They are merged once all workers have joined:
+			const BranchEvaluator startBranchEval(branchEval);
+			std::deque<BranchEvaluator> deqWorkerBranchEvaluators(nr_workers, branchEval);
+
+			std::vector<std::exception_ptr> vecExceptions(nr_workers, nullptr);
+
+			auto run_worker = [&](const uint32_t idxWorker, MasterProblem& wmp, PricingProblem& wpp)
+			{
+				OpenBranchNode parentOpenBranchNode;
+				BranchNode parentBranchNode;
+				Branch leftBranch, rightBranch, strongBranch;
+				Stats::PlanningHorizon wstats_ph;
+				Solution wsol;
+				BranchEvaluator& wbranchEval = deqWorkerBranchEvaluators[idxWorker];
+				std::deque<PricingProblem> deqStrongBranchingPricingProblems; // Unused, strong branching is evaluated serially by each worker.
+				std::deque<MasterProblem> deqStrongBranchingMasterProblems; // Unused, strong branching is evaluated serially by each worker.
+				std::vector<OpenBranchNode> vecChildBranchNodes;
+				size_t poolCursor = 0;
+				Types::Index indexChild = 0;
+
+				{
+					std::lock_guard<std::mutex> lock(search.mutex);
+					wsol = search.incumbent;
+				}
+
+				while (true)
+				{
+					// 1. Retrieve the currently most promising open node, or wait until one becomes available:
+					{
+						std::unique_lock<std::mutex> lock(search.mutex);
+						search.cv.wait(lock, [&]() { return search.terminate || !search.pQ.empty() || search.nr_active_workers == 0; });
+
+						if (search.terminate
+							|| search.pQ.empty()
+							|| std::chrono::high_resolution_clock::now() > timeOutBnP)
+						{
+							// Either all nodes have been explored, or the search is stopped:
+							search.terminate = true;
+							search.cv.notify_all();
+							return;
+						}
+
+						parentOpenBranchNode = search.pQ.top();
+						search.pQ.pop();
+
+						++search.nr_active_workers;
+						search.vecWorkerLb[idxWorker] = parentOpenBranchNode.lb;
+
+						wstats_ph = stats_ph;
+						if (Helper::compare_floats_smaller(search.incumbent.objective, wsol.objective))
+							wsol = search.incumbent;
+					}
+
+					// 2. Solve both children, unless the node has been pruned by bounds in the meantime:
+					vecChildBranchNodes.clear();
+					if (!parentOpenBranchNode.ptrSortedBranchOptions->empty()
+						&& Helper::compare_floats_smaller(parentOpenBranchNode.lb, wsol.objective))
+					{
+						// Rebuild the branches and fixings of the node:
+						parentBranchNode = BranchNode(parentOpenBranchNode, root_brn, optinput);
+
+						// a. Add the columns of the other workers to the pool of this worker:
+						{
+							std::lock_guard<std::mutex> lock(search.mutexPool);
+							poolCursor = std::max(poolCursor, search.poolOffset);
+							for (; poolCursor < search.poolOffset + search.deqColumnPool.size(); ++poolCursor)
+							{
+								const auto& poolEntry = search.deqColumnPool[poolCursor - search.poolOffset];
+								if (poolEntry.first != idxWorker)
+									wmp.store_schedule_in_pool(poolEntry.second);
+							}
+						}
+
+						// b. Pick strong branch:
+						strongBranch = get_strong_branch(optinput, wbranchEval, wmp, wpp, deqStrongBranchingPricingProblems, deqStrongBranchingMasterProblems, wsol, wstats_ph, parentBranchNode, timeOutBnP);
+
+						leftBranch = strongBranch;
+						leftBranch.set_branchValue(std::floor(leftBranch.get_fractionalValue()));
+
+						rightBranch = strongBranch;
+						rightBranch.set_branchValue(std::ceil(rightBranch.get_fractionalValue()));
+
+						for (const Branch& newBranch : { leftBranch, rightBranch })
+						{
+							{
+								std::lock_guard<std::mutex> lock(search.mutex);
+								indexChild = ++stats_ph.branchingTree_size;
+							}
+
+							BranchNode childBranchNode(indexChild, parentBranchNode, newBranch, optinput);
+
+							// c. Filter the variables, and store the branch details:
+							filter_branch_node(optinput, wmp, wpp, parentBranchNode, childBranchNode, newBranch);
+
+							// d. Solve the branching node:
+							ColumnGenerationResults cg_res = column_generation(optinput, childBranchNode, wmp, wpp, wsol, childBranchNode.get_lb(), false, 0.0, timeOutBnP);
+
+							// If the branch node is infeasible, it is pruned:
+							if (cg_res.isFeasible)
+							{
+								childBranchNode.store_branchOptionsBranchAndPrice(wmp.get_vecBranchOptions());
+								childBranchNode.update_lb(cg_res.lb);
+
+								// e. Share the columns with positive value in the RMP that no worker has shared yet.
+								// This skips the columns the worker took from the pool, and the ones another worker generated as well:
+								{
+									std::lock_guard<std::mutex> lock(search.mutexPool);
+									for (const SubVehicleSchedule& schedule : wmp.get_vecActiveSchedules())
+									{
+										if (search.setSharedSignatures.insert(schedule.signatureHash).second)
+											search.deqColumnPool.emplace_back(idxWorker, schedule);
+									}
+
+									while (search.deqColumnPool.size() > max_pool_size)
+									{
+										search.deqColumnPool.pop_front();
+										++search.poolOffset;
+									}
+								}
+
+								// Check if the branch node is pruned by bounds:
+								if (Helper::compare_floats_smaller(childBranchNode.get_lb(), wsol.objective))
+								{
+									// If branching tree size == mod X, perform the diving heuristic to explore the depths of this branch:
+									if (childBranchNode.get_index() % optinput.get_config().get_const_nth_branching_node_dive() == 0)
+									{
+										eva::Stats::PerformanceDetail quick_pd_pre;
+										quick_pd_pre.branchType = "Start Quick Dive";
+										optinput.get_dataHandler().storeStatsPerformanceDetail(quick_pd_pre);
+										truncated_column_generation(optinput, timeOutBnP, wmp, wpp, childBranchNode, wsol, wstats_ph);
+										eva::Stats::PerformanceDetail quick_pd_post;
+										quick_pd_post.branchType = "End Quick Dive";
+										optinput.get_dataHandler().storeStatsPerformanceDetail(quick_pd_post);
+									}
+
+									vecChildBranchNodes.push_back(childBranchNode.get_openBranchNode(std::make_shared<const BranchPath>(BranchPath{ parentOpenBranchNode.ptrPath, newBranch })));
+								}
+							}
+						}
+					}
+
+					// 3. Publish the incumbent and the open children, and update the global bounds:
+					{
+						std::lock_guard<std::mutex> lock(search.mutex);
+						if (Helper::compare_floats_smaller(wsol.objective, search.incumbent.objective))
+							search.incumbent = wsol;
+
+						for (const OpenBranchNode& childOpenBranchNode : vecChildBranchNodes)
+						{
+							if (Helper::compare_floats_smaller(childOpenBranchNode.lb, search.incumbent.objective))
+								search.pQ.push(childOpenBranchNode);
+						}
+
+						if (!vecChildBranchNodes.empty())
+							stats_ph.branchingTree_depth = std::max(stats_ph.branchingTree_depth, 1 + (static_cast<uint32_t>(parentBranchNode.get_vecBranches().size() - root_brn.get_vecBranches().size())));
+
+						--search.nr_active_workers;
+						search.vecWorkerLb[idxWorker] = Constants::BIG_DOUBLE;
+
+						stats_ph.ub_integer = search.incumbent.objective;
+						stats_ph.lb_integer = search.get_lb();
+
+						// Check if a sufficient integer gap has been achieved:
+						if (Helper::compare_floats_smaller(stats_ph.gap_integer(), optinput.get_config().get_const_integer_optimality_gap()))
+							search.terminate = true;
+
+						search.cv.notify_all();
+					}
+				}
+			};
+
+			auto run_worker_safe = [&](const uint32_t idxWorker, MasterProblem& wmp, PricingProblem& wpp)
+			{
+				try
+				{
+					run_worker(idxWorker, wmp, wpp);
+				}
+				catch (...)
+				{
+					// Stop all workers, and rethrow once all have joined:
+					std::lock_guard<std::mutex> lock(search.mutex);
+					vecExceptions[idxWorker] = std::current_exception();
+					search.terminate = true;
+					search.cv.notify_all();
+				}
+			};
+
+			// Start the workers. Worker 0 runs on this thread with the original master and pricing problem:
+			std::vector<std::thread> vecThreads;
+			for (uint32_t idxWorker = 1; idxWorker < nr_workers; ++idxWorker)
+			{
+				vecThreads.emplace_back([&, idxWorker]()
+				{
+					std::unique_ptr<PricingProblem> wpp;
+					try
+					{
+						wpp = std::make_unique<PricingProblem>(optinput, nr_threads_per_worker);
+					}
+					catch (...)
+					{
+						std::lock_guard<std::mutex> lock(search.mutex);
+						vecExceptions[idxWorker] = std::current_exception();
+						search.terminate = true;
+						search.cv.notify_all();
+						return;
+					}
+					run_worker_safe(idxWorker, deqWorkerMasterProblems[idxWorker - 1], *wpp);
+				});
+			}
+
+			mp.set_nr_threads(nr_threads_per_worker);
+			pp.set_nr_threads(nr_threads_per_worker);
+			run_worker_safe(0, mp, pp);
+			mp.set_nr_threads(optinput.get_config().get_const_nr_threads());
+			pp.set_nr_threads(optinput.get_config().get_const_nr_threads());
+
+			for (std::thread& thread : vecThreads)
+				thread.join();
+
+			for (const std::exception_ptr& exceptionPtr : vecExceptions)
+			{
+				if (exceptionPtr)
+					std::rethrow_exception(exceptionPtr);
+			}
+
+			for (const BranchEvaluator& wbranchEval : deqWorkerBranchEvaluators)
+				branchEval.merge(wbranchEval, startBranchEval);
+
+			// Store the results of the search:
+			if (Helper::compare_floats_smaller(search.incumbent.objective, sol.objective))
+				sol = search.incumbent;
+
+			stats_ph.ub_integer = sol.objective;
+			stats_ph.lb_integer = search.get_lb();
+		};
+
 		static void bestf_bnp(OptimisationInput& optinput, BranchEvaluator& branchEval, const std::chrono::high_resolution_clock::time_point& timeOutBnP, MasterProblem& mp, PricingProblem& pp, BranchNode& root_brn, Solution& sol, Stats::PlanningHorizon& stats_ph)
 		{
-			std::priority_queue<BranchNode, std::vector<BranchNode>, BranchNode::CompareLb> pQ;
+			std::priority_queue<OpenBranchNode, std::vector<OpenBranchNode>, OpenBranchNode::CompareLb> pQ;
+			std::deque<PricingProblem> deqWorkerPricingProblems; // Only constructed if strong branching is evaluated in parallel.
+			std::deque<MasterProblem> deqWorkerMasterProblems; // Only constructed if strong branching is evaluated in parallel.
+
+			// Explore the search tree with multiple workers:
+			if (optinput.get_config().get_flag_parallel_tree_search() && optinput.get_config().get_const_nr_threads() > 1)
+			{
+				parallel_bestf_bnp(optinput, branchEval, timeOutBnP, mp, pp, root_brn, sol, stats_ph);
+				return;
+			}
 
 			// 2. Initialise priority queue with results on root node:
-			pQ.push(root_brn);
+			pQ.push(root_brn.get_openBranchNode(nullptr));
 
 			// 3. Start branching:		
+			OpenBranchNode parentOpenBranchNode;
 			BranchNode parentBranchNode;
 			Branch leftBranch, rightBranch, strongBranch;
 			while (!pQ.empty()
 				&& std::chrono::high_resolution_clock::now() <= timeOutBnP)
 			{
 				// Retrieve the currently most promising branching node:
-				parentBranchNode = pQ.top();
+				parentOpenBranchNode = pQ.top();
 				pQ.pop();
 
+				// Rebuild the branches and fixings of the node:
+				parentBranchNode = BranchNode(parentOpenBranchNode, root_brn, optinput);
+
 				if (!parentBranchNode.get_vecSortedBranchOptions().empty())
 				{
 					// Pick strong branch:
-					strongBranch = get_strong_branch(optinput,branchEval,mp,pp,sol,stats_ph,parentBranchNode,timeOutBnP);
+					strongBranch = get_strong_branch(optinput,branchEval,mp,pp,deqWorkerPricingProblems,deqWorkerMasterProblems,sol,stats_ph,parentBranchNode,timeOutBnP);
 
 					//leftBranch = parentBranchNode.get_nextBranch();
 					leftBranch = strongBranch;
@@ -816,77 +1426,8 @@ namespace eva
 					{
 						BranchNode childBranchNode(++stats_ph.branchingTree_size, parentBranchNode, newBranch, optinput);
 
-						// Store the branch details:
-						Stats::PerformanceDetail stats_pd;
-						stats_pd.indexPlanningHorizon = optinput.get_indexPlanningHorizon();
-						stats_pd.indexBranchingNode = childBranchNode.get_index();
-						stats_pd.indexParentBranchingNode = parentBranchNode.get_index();
-						stats_pd.fractionalValue = newBranch.get_fractionalValue();
-						stats_pd.branchValue = newBranch.get_branchValue();
-						stats_pd.branchType = newBranch.get_branchTypeName();
-
-						int indexFromScheduleNode = -1;
-						int indexToScheduleNode = -1;
-						int indexCharger = -1;
-						switch (newBranch.get_type())
-						{
-						case BranchType::TRIP_UNASSIGNED:
-							indexFromScheduleNode = newBranch.castBranchTripUnassigned()->get_subTripNodeData().get_scheduleNodeData().get_index();
-							indexToScheduleNode = newBranch.castBranchTripUnassigned()->get_subTripNodeData().get_scheduleNodeData().get_index();
-							indexCharger = -1;
-							break;
-						case BranchType::VEHICLE_CHARGING_AFTER:
-							stats_pd.VehicleId = newBranch.castBranchVehicleChargingAfter()->get_vehicle().get_id();
-							indexFromScheduleNode = newBranch.castBranchVehicleChargingAfter()->get_indexFromScheduleNode();
-							indexCharger = newBranch.castBranchVehicleChargingAfter()->get_charger().get_index();
-							break;
-						case BranchType::VEHICLE_CHARGING_BEFORE:
-							stats_pd.VehicleId = newBranch.castBranchVehicleChargingBefore()->get_vehicle().get_id();
-							indexToScheduleNode = newBranch.castBranchVehicleChargingBefore()->get_indexToScheduleNode();
-							indexCharger = newBranch.castBranchVehicleChargingBefore()->get_charger().get_index();
-							break;
-						case BranchType::VEHICLE_ROTATION:
-							stats_pd.VehicleId = newBranch.castBranchVehicleRotation()->get_vehicle().get_id();
-							break;
-						case BranchType::VEHICLE_TRIP:
-							stats_pd.TripId = newBranch.castBranchVehicleTrip()->get_subTripNodeData().get_ptrTripNodeData()->get_trip().get_id();
-							indexFromScheduleNode = newBranch.castBranchVehicleTrip()->get_subTripNodeData().get_scheduleNodeData().get_index();
-							indexToScheduleNode = newBranch.castBranchVehicleTrip()->get_subTripNodeData().get_scheduleNodeData().get_index();
-							indexCharger = -1;
-							stats_pd.VehicleId = newBranch.castBranchVehicleTrip()->get_vehicle().get_id();
-							break;
-						case BranchType::VEHICLE_MAINTENANCE:
-							stats_pd.MaintenanceId = newBranch.castBranchVehicleMaintenance()->get_subMaintenanceNodeData().get_ptrMaintenanceNodeData()->get_maintenance().get_id();
-							indexFromScheduleNode = newBranch.castBranchVehicleMaintenance()->get_subMaintenanceNodeData().get_scheduleNodeData().get_index();
-							indexToScheduleNode = newBranch.castBranchVehicleMaintenance()->get_subMaintenanceNodeData().get_scheduleNodeData().get_index();
-							indexCharger = 0;
-							stats_pd.VehicleId = newBranch.castBranchVehicleMaintenance()->get_vehicle().get_id();
-							break;
-						default:
-							break;
-						}
-
-						// Solve the branching node:
-						stats_pd.time_mpFilterVars = mp.get_totalRuntimeFilterVars();
-						stats_pd.time_ppFilterNodes = pp.get_totalRuntimeFilterNodes();
-
-						// 6. Filter the variables:
-						mp.filterVars(childBranchNode);
-						pp.updateNodeAccess(childBranchNode);
-
-						stats_pd.time_mpFilterVars = mp.get_totalRuntimeFilterVars() - stats_pd.time_mpFilterVars;
-						stats_pd.time_ppFilterNodes = pp.get_totalRuntimeFilterNodes() - stats_pd.time_ppFilterNodes;
-
-						optinput.get_dataHandler().storeStatsPerformanceDetail(stats_pd);
-
-#ifdef DEBUG_BUILD
-						// Summarise the output:
-						auto tid = stats_pd.TripId != Constants::BIG_UINTEGER ? std::to_string(stats_pd.TripId) : "";
-						auto mid = stats_pd.MaintenanceId != Constants::BIG_UINTEGER ? std::to_string(stats_pd.MaintenanceId) : "";
-						auto vid = stats_pd.VehicleId != Constants::BIG_UINTEGER ? std::to_string(stats_pd.VehicleId) : "";
-						std::cout << stats_pd.branchType << ": " << stats_pd.fractionalValue << " -> " << stats_pd.branchValue << ", Vehicle: " << vid
-						 << ", Charger: " << indexCharger << ", From:  " << indexFromScheduleNode << ", To: " << indexToScheduleNode << std::endl;
-#endif
+						// 6. Filter the variables, and store the branch details:
+						filter_branch_node(optinput, mp, pp, parentBranchNode, childBranchNode, newBranch);
 
 						// 7. Solve the branching node:
 						ColumnGenerationResults cg_res = column_generation(optinput, childBranchNode, mp, pp, sol, childBranchNode.get_lb(), false, 0.0,timeOutBnP);
@@ -924,7 +1465,7 @@ namespace eva
 									stats_ph.branchingTree_depth = cur_stats_ph_depth;
 								}
 
-								pQ.push(childBranchNode);
+								pQ.push(childBranchNode.get_openBranchNode(std::make_shared<const BranchPath>(BranchPath{ parentOpenBranchNode.ptrPath, newBranch })));
 #ifdef DEBUG_BUILD
 								if (mp.get_currentSolutionStatus() == MasterProblemSolutionStatus::MP_INTEGER)
 								{
@@ -959,12 +1500,12 @@ namespace eva
 				// Update the lb integer after exploring both new branching nodes:
 				// Or if the only node left, or the root node already is optimal, skip right here to verify it is now optimal.
 				// Maybe the best lb has improved without the ub has improved. So, an integer node might have already been discovered somewhere.
-				stats_ph.lb_integer = pQ.empty() ? stats_ph.lb_integer : pQ.top().get_lb();
+				stats_ph.lb_integer = pQ.empty() ? stats_ph.lb_integer : pQ.top().lb;
 
 				if (pQ.empty())
 					stats_ph.lb_integer = sol.objective; // Optimal solution found because there are not more branching nodes to explore. Entire search tree explored.
 				else
-					stats_ph.lb_integer = pQ.top().get_lb(); // Else, the current top node stores the global lower bound in the search tree.
+					stats_ph.lb_integer = pQ.top().lb; // Else, the current top node stores the global lower bound in the search tree.
 
 #ifdef DEBUG_BUILD
 				std::cout << "LB: " << stats_ph.lb_integer << " UB:" << sol.objective << std::endl;
@@ -1127,7 +1668,7 @@ namespace eva
 			}
 		};
 
-		static void solvePlanningHorizon(OptimisationInput& optinput, Solution& solution, Stats::PlanningHorizon& stats_ph)
+		static void solvePlanningHorizon(OptimisationInput& optinput, Solution& solution, Stats::PlanningHorizon& stats_ph, HorizonDuals& horizonDuals)
 		{
 			// Init the stats_ph object:
 			stats_ph.lb_integer = -Constants::BIG_DOUBLE;
@@ -1162,6 +1703,18 @@ namespace eva
 				break;
 			}
 
+			// Warm-start the root node with the columns priced out with the duals of the previous planning horizon.
+			// The columns are generated by the pricing problem of this planning horizon, hence they start at the committed vehicle states:
+			if (optinput.get_config().get_flag_horizon_warm_start() && horizonDuals.is_set())
+			{
+				Duals seedDuals(optinput);
+				horizonDuals.seed(optinput, seedDuals);
+
+				PricingProblemResult warmStartResult = pp.find_neg_reduced_cost_schedule(seedDuals, root_brn, true, false, true, timeOutClock);
+				StatusVarSchedulesAdded warmStartAdded = mp.addVarsSchedule(warmStartResult.resSchedule, true);
+				std::cout << "Warm-Start Root Node: " << warmStartAdded.columnsAdded << " columns." << std::endl;
+			}
+
 			// Solve the root node:
 			// Avoid solving the root node to optimality, if only trunc. CG is used:
 			ColumnGenerationResults root_cg_res;
@@ -1174,6 +1727,9 @@ namespace eva
 
 			root_brn.update_lb(root_cg_res.lb);
 			auto rootBranchOptions = mp.get_vecBranchOptions();
+
+			if (root_cg_res.isFeasible)
+				horizonDuals.store(optinput, mp.get_currentDuals());
 			
 			if(optinput.get_config().get_flag_terminate_after_root())
 				return;
@@ -1342,6 +1898,9 @@ void eva::Optimiser::run()
 
 	std::chrono::high_resolution_clock::time_point startClock;
 
+	// The root duals are carried over to warm-start the next planning horizon:
+	HorizonDuals horizonDuals;
+
 	// 2. Loop until the end of the planning horizon is reached:
 	do
 	{
@@ -1366,7 +1925,7 @@ void eva::Optimiser::run()
 		stats_planningHorizon.endOverlapPlanningHorizon = optinput.get_endPlanningHorizonOverlap();
 
 		// c. Solve the planning horizon:
-		Algorithms::solvePlanningHorizon(optinput, solution, stats_planningHorizon);
+		Algorithms::solvePlanningHorizon(optinput, solution, stats_planningHorizon, horizonDuals);
 
 		// d. Update the stats and the schedule:
 		// Trim the solution, and remove the nodes outside of the planning horizon:
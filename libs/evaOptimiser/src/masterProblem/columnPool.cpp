@@ -0,0 +1,278 @@
+#include "incl/masterProblem/columnPool.h"
+
+#include <algorithm>
+#include <omp.h>
+
+eva::ColumnPool::ColumnPool(const OptimisationInput& optinput) : _optinput(optinput), _nr_threads(optinput.get_config().get_const_nr_threads())
+{
+	// Offsets of the constraint groups in the concatenated vector of duals:
+	_offsetTrips = _optinput.get_vehicles().get_vec().size();
+	_offsetMaintenances = _offsetTrips + _optinput.get_vecTrips().size();
+
+	uint32_t offset = _offsetMaintenances + _optinput.get_vecMaintenances().size();
+	_vecOffsetChargers.resize(_optinput.get_chargers().get_vec().size());
+	for (const Charger& charger : _optinput.get_chargers().get_vec())
+	{
+		_vecOffsetChargers[charger.get_index()] = offset;
+		offset += _optinput.get_vecPutOnChargeNodes(charger.get_index()).size() + 1;
+	}
+	_vecDualValues.resize(offset, 0.0);
+
+	_vecVehicleColumns.resize(_optinput.get_vehicles().get_vec().size());
+	_vecTripColumns.resize(_optinput.get_vecTrips().size());
+}
+
+void eva::ColumnPool::push_back(SubVehicleSchedule schedule)
+{
+	if (_optinput.get_config().get_const_max_number_cols_mp_pool() == 0)
+		return;
+
+	// First-in-first-out principle on how to manage the pool schedules.
+	// Ids of the schedules that were already extracted are skipped:
+	while (_vecColumns.size() >= _optinput.get_config().get_const_max_number_cols_mp_pool() && !_deqInsertionOrder.empty())
+	{
+		auto iterPos = _mapPosById.find(_deqInsertionOrder.front());
+		_deqInsertionOrder.pop_front();
+		if (iterPos != _mapPosById.end())
+			_remove(iterPos->second);
+	}
+
+	const Types::Index pos = _vecColumns.size();
+	const uint64_t id = _nextId++;
+
+	// 1. Column, moved into the pool:
+	_vecColumns.push_back(std::move(schedule));
+	const SubVehicleSchedule& column = _vecColumns.back();
+	_vecIds.push_back(id);
+	_vecCost.push_back(column.cost);
+	_vecCoeffStart.push_back(_vecCoeffIndex.size());
+	_vecReducedCost.push_back(0.0);
+	_deqInsertionOrder.push_back(id);
+	_mapPosById[id] = pos;
+
+	// 2. Dual coefficients, matching SubVehicleSchedule::get_current_reducedCost:
+	_addCoefficient(column.indexVehicle, 1.0);
+	for (const Types::Index& indexTrip : column.vecTripNodeIndexes)
+		_addCoefficient(_offsetTrips + indexTrip, 1.0);
+	for (const Types::Index& indexMaintenance : column.vecMaintenanceNodesIndexes)
+		_addCoefficient(_offsetMaintenances + indexMaintenance, 1.0);
+	for (const ChargingSchedule& cs : column.vecChargingSchedule)
+	{
+		_addCoefficient(_vecOffsetChargers[cs.indexCharger] + cs.indexTakeOffCharge + 1, 1.0);
+		_addCoefficient(_vecOffsetChargers[cs.indexCharger] + cs.indexPutOnCharge, -1.0);
+	}
+	_vecCoeffCount.push_back(_vecCoeffIndex.size() - _vecCoeffStart.back());
+
+	// 3. Indexes:
+	_vecPosInVehicleColumns.push_back(_vecVehicleColumns[column.indexVehicle].size());
+	_vecVehicleColumns[column.indexVehicle].push_back(pos);
+
+	_vecPosInTripColumns.emplace_back();
+	_vecPosInTripColumns.back().reserve(column.vecTripNodeIndexes.size());
+	for (const Types::Index& indexTrip : column.vecTripNodeIndexes)
+	{
+		_vecPosInTripColumns.back().push_back(_vecTripColumns[indexTrip].size());
+		_vecTripColumns[indexTrip].push_back(pos);
+	}
+}
+
+void eva::ColumnPool::_remove(const Types::Index& pos)
+{
+	const Types::Index last = _vecColumns.size() - 1;
+
+	// 1. Detach the column from the indexes, by swapping the last entry of each list into its place:
+	{
+		std::vector<Types::Index>& vecVehicleColumns = _vecVehicleColumns[_vecColumns[pos].indexVehicle];
+		const Types::Index posInList = _vecPosInVehicleColumns[pos];
+		vecVehicleColumns[posInList] = vecVehicleColumns.back();
+		_vecPosInVehicleColumns[vecVehicleColumns[posInList]] = posInList;
+		vecVehicleColumns.pop_back();
+	}
+
+	for (Types::Index posTrip = 0; posTrip < _vecColumns[pos].vecTripNodeIndexes.size(); ++posTrip)
+	{
+		const Types::Index indexTrip = _vecColumns[pos].vecTripNodeIndexes[posTrip];
+		std::vector<Types::Index>& vecTripColumns = _vecTripColumns[indexTrip];
+		const Types::Index posInList = _vecPosInTripColumns[pos][posTrip];
+
+		const Types::Index movedColumn = vecTripColumns.back();
+		vecTripColumns[posInList] = movedColumn;
+		vecTripColumns.pop_back();
+
+		if (movedColumn != pos)
+		{
+			const auto& vecMovedTrips = _vecColumns[movedColumn].vecTripNodeIndexes;
+			_vecPosInTripColumns[movedColumn][std::find(vecMovedTrips.begin(), vecMovedTrips.end(), indexTrip) - vecMovedTrips.begin()] = posInList;
+		}
+	}
+
+	_nrDeadCoeffs += _vecCoeffCount[pos];
+	_mapPosById.erase(_vecIds[pos]);
+
+	// 2. Move the last column into the gap, and redirect its index entries:
+	if (pos != last)
+	{
+		_vecColumns[pos] = std::move(_vecColumns[last]);
+		_vecIds[pos] = _vecIds[last];
+		_vecCost[pos] = _vecCost[last];
+		_vecCoeffStart[pos] = _vecCoeffStart[last];
+		_vecCoeffCount[pos] = _vecCoeffCount[last];
+		_vecReducedCost[pos] = _vecReducedCost[last];
+		_vecPosInVehicleColumns[pos] = _vecPosInVehicleColumns[last];
+		_vecPosInTripColumns[pos] = std::move(_vecPosInTripColumns[last]);
+
+		_vecVehicleColumns[_vecColumns[pos].indexVehicle][_vecPosInVehicleColumns[pos]] = pos;
+		for (Types::Index posTrip = 0; posTrip < _vecColumns[pos].vecTripNodeIndexes.size(); ++posTrip)
+			_vecTripColumns[_vecColumns[pos].vecTripNodeIndexes[posTrip]][_vecPosInTripColumns[pos][posTrip]] = pos;
+		_mapPosById[_vecIds[pos]] = pos;
+	}
+
+	_vecColumns.pop_back();
+	_vecIds.pop_back();
+	_vecCost.pop_back();
+	_vecCoeffStart.pop_back();
+	_vecCoeffCount.pop_back();
+	_vecReducedCost.pop_back();
+	_vecPosInVehicleColumns.pop_back();
+	_vecPosInTripColumns.pop_back();
+
+	// 3. Once the majority of the coefficients belongs to removed columns, rebuild the coefficient vectors:
+	if (_nrDeadCoeffs > _vecCoeffIndex.size() / 2)
+		_compact();
+
+	// 4. Likewise, once the majority of the insertion order belongs to removed columns, drop their ids:
+	if (_deqInsertionOrder.size() > 2 * _vecColumns.size())
+	{
+		_deqInsertionOrder.erase(
+			std::remove_if(_deqInsertionOrder.begin(), _deqInsertionOrder.end(), [&](const uint64_t& id) { return _mapPosById.find(id) == _mapPosById.end(); }),
+			_deqInsertionOrder.end());
+	}
+}
+
+void eva::ColumnPool::_compact()
+{
+	std::vector<uint32_t> vecCoeffIndex;
+	std::vector<double> vecCoeffValue;
+	vecCoeffIndex.reserve(_vecCoeffIndex.size() - _nrDeadCoeffs);
+	vecCoeffValue.reserve(_vecCoeffValue.size() - _nrDeadCoeffs);
+
+	for (Types::Index pos = 0; pos < _vecColumns.size(); ++pos)
+	{
+		const uint32_t start = _vecCoeffStart[pos];
+		_vecCoeffStart[pos] = vecCoeffIndex.size();
+		vecCoeffIndex.insert(vecCoeffIndex.end(), _vecCoeffIndex.begin() + start, _vecCoeffIndex.begin() + start + _vecCoeffCount[pos]);
+		vecCoeffValue.insert(vecCoeffValue.end(), _vecCoeffValue.begin() + start, _vecCoeffValue.begin() + start + _vecCoeffCount[pos]);
+	}
+
+	_vecCoeffIndex.swap(vecCoeffIndex);
+	_vecCoeffValue.swap(vecCoeffValue);
+	_nrDeadCoeffs = 0;
+}
+
+void eva::ColumnPool::_updateDualValues(const Duals& duals)
+{
+	std::copy(duals.vecDualsOneSchedulePerVehicle.begin(), duals.vecDualsOneSchedulePerVehicle.end(), _vecDualValues.begin());
+	std::copy(duals.vecDualsTripCoverage.begin(), duals.vecDualsTripCoverage.end(), _vecDualValues.begin() + _offsetTrips);
+	std::copy(duals.vecDualsOneVehiclePerMaintenance.begin(), duals.vecDualsOneVehiclePerMaintenance.end(), _vecDualValues.begin() + _offsetMaintenances);
+	for (Types::Index indexCharger = 0; indexCharger < _vecOffsetChargers.size(); ++indexCharger)
+		std::copy(duals.vecPrefixSumDualsChargerCapacity[indexCharger].begin(), duals.vecPrefixSumDualsChargerCapacity[indexCharger].end(), _vecDualValues.begin() + _vecOffsetChargers[indexCharger]);
+}
+
+void eva::ColumnPool::_updateReducedCosts()
+{
+	const uint32_t* coeffIndex = _vecCoeffIndex.data();
+	const double* coeffValue = _vecCoeffValue.data();
+	const double* dualValues = _vecDualValues.data();
+
+#ifdef DEBUG_BUILD
+	omp_set_num_threads(1);
+#else
+	omp_set_num_threads(_nr_threads);
+#endif // DEBUG_BUILD
+#pragma omp parallel for
+	for (int32_t pos = 0; pos < static_cast<int32_t>(_vecColumns.size()); ++pos)
+	{
+		double sumDualValues = 0.0;
+		const uint32_t end = _vecCoeffStart[pos] + _vecCoeffCount[pos];
+		for (uint32_t posCoeff = _vecCoeffStart[pos]; posCoeff < end; ++posCoeff)
+			sumDualValues += coeffValue[posCoeff] * dualValues[coeffIndex[posCoeff]];
+
+		_vecReducedCost[pos] = _vecCost[pos] - sumDualValues;
+	}
+}
+
+std::vector<std::vector<eva::SubVehicleSchedule>> eva::ColumnPool::extract_columns(const Duals& duals, const BranchNode& brn, const uint32_t& maxPerVehicle)
+{
+	std::vector<std::vector<SubVehicleSchedule>> result(_vecVehicleColumns.size());
+	if (_vecColumns.empty())
+		return result;
+
+	// 1. Reduced cost of all columns in one pass:
+	_updateDualValues(duals);
+	_updateReducedCosts();
+
+	// 2. Exclude the columns that contradict a trip or vehicle branch via the indexes:
+	std::vector<char> vecExcluded(_vecColumns.size(), 0);
+	for (const Branch& branch : brn.get_vecBranches())
+	{
+		switch (branch.get_type())
+		{
+		case BranchType::VEHICLE_ROTATION:
+			if (!branch.get_branchValueBool())
+			{
+				for (const Types::Index& pos : _vecVehicleColumns[branch.castBranchVehicleRotation()->get_vehicle().get_index()])
+					vecExcluded[pos] = 1;
+			}
+			break;
+
+		case BranchType::TRIP_UNASSIGNED:
+			if (branch.get_branchValueBool())
+			{
+				for (const Types::Index& pos : _vecTripColumns[branch.castBranchTripUnassigned()->get_subTripNodeData().get_index()])
+					vecExcluded[pos] = 1;
+			}
+			break;
+
+		case BranchType::VEHICLE_TRIP:
+		{
+			// A fixed trip excludes the other vehicles, and a forbidden trip excludes the vehicle:
+			const Types::Index indexVehicle = branch.castBranchVehicleTrip()->get_vehicle().get_index();
+			for (const Types::Index& pos : _vecTripColumns[branch.castBranchVehicleTrip()->get_subTripNodeData().get_index()])
+			{
+				if (branch.get_branchValueBool() ^ (_vecColumns[pos].indexVehicle == indexVehicle))
+					vecExcluded[pos] = 1;
+			}
+		}
+		break;
+
+		default:
+			break;
+		}
+	}
+
+	// 3. Check the remaining candidates with negative reduced cost, from the oldest to the newest:
+	std::vector<Types::Index> vecCandidates;
+	for (Types::Index pos = 0; pos < _vecColumns.size(); ++pos)
+	{
+		if (!vecExcluded[pos] && Helper::compare_floats_smaller(_vecReducedCost[pos], 0.0))
+			vecCandidates.push_back(pos);
+	}
+	std::sort(vecCandidates.begin(), vecCandidates.end(), [&](const Types::Index& l, const Types::Index& r) { return _vecIds[l] < _vecIds[r]; });
+
+	std::vector<uint64_t> vecExtractIds;
+	for (const Types::Index& pos : vecCandidates)
+	{
+		const Types::Index& indexVehicle = _vecColumns[pos].indexVehicle;
+		if (result[indexVehicle].size() < maxPerVehicle && _vecColumns[pos].isFeasibleInBranchNode(brn))
+		{
+			result[indexVehicle].push_back(_vecColumns[pos]);
+			vecExtractIds.push_back(_vecIds[pos]);
+		}
+	}
+
+	// 4. Remove the extracted columns from the pool:
+	for (const uint64_t& id : vecExtractIds)
+		_remove(_mapPosById.at(id));
+
+	return result;
+}
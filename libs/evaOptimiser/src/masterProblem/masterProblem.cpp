@@ -1,7 +1,10 @@
 #include "incl/masterProblem/masterProblem.h"
 
 #include "evaExceptions.h"
+#include <algorithm>
 #include <chrono>
+#include <numeric>
+#include <unordered_set>
 
 #ifdef DEBUG_BUILD
 // Use (void) to silence unused warnings.
@@ -17,10 +20,78 @@ namespace eva
 		static const bool isOne(const double& value) { return Helper::compare_floats_equal(1.0, value); };
 		static const bool isInteger(const double& value) { return Helper::compare_floats_equal(std::nearbyint(value), value); };
 		static const bool isFractional(const double& value) { return !isInteger(value); };
+
+		// The bound of [lb, ub] that minimises value * x:
+		static const double activeBound(const double& lb, const double& ub, const double& value) 
+		{ 
+			if (Helper::compare_floats_smaller(0.0, value)) return lb;
+			if (Helper::compare_floats_smaller(value, 0.0)) return ub;
+			return lb > -kHighsInf ? lb : (ub < kHighsInf ? ub : 0.0);
+		};
+		static const bool isInfinite(const double& value) { return value <= -kHighsInf || value >= kHighsInf; };
+
+		// The objective coefficients of all columns are integer, if the cost coefficients are. The distances are integer by construction.
+		// The maintenance penalty is half of its coefficient times the squared distance, hence the coefficient must be even:
+		static const bool hasIntegerCosts(const OptimisationInput& optinput)
+		{
+			const Config& config = optinput.get_config();
+			bool result = isInteger(config.get_cost_deadleg_fix())
+				&& isInteger(config.get_cost_deadleg_per_km())
+				&& isInteger(0.5 * config.get_cost_coefficient_penalty_maintenance())
+				&& isInteger(config.get_cost_uncovered_trip());
+
+			if (config.get_flag_minimise_number_vehicles())
+				result = result && std::all_of(optinput.get_vehicles().get_vec().begin(), optinput.get_vehicles().get_vec().end(), [](const Vehicle& vehicle) { return isInteger(vehicle.get_cost()); });
+
+			return result;
+		};
 	}
 }
 
-void eva::MasterProblem::_initialise()
+eva::MasterProblem::MasterProblem(const MasterProblem& other) :
+	_optinput(other._optinput),
+	_currentHighsSolution(other._currentHighsSolution),
+	_currentDuals(other._currentDuals),
+	_currentSolutionStatus(other._currentSolutionStatus),
+	_varsTotalVehiclesSlacks(other._varsTotalVehiclesSlacks),
+	_varsTotalTripsUnassignedSlacks(other._varsTotalTripsUnassignedSlacks),
+	_vecVarUnallocatedTrips(other._vecVarUnallocatedTrips),
+	_vecVarVehicleSelected(other._vecVarVehicleSelected),
+	_vecVarVehicleSchedules(other._vecVarVehicleSchedules),
+	_columnPool(other._columnPool),
+	_vecAppliedBranches(other._vecAppliedBranches),
+	_vecTripScheduleColumns(other._vecTripScheduleColumns),
+	_vecMaintenanceScheduleColumns(other._vecMaintenanceScheduleColumns),
+	_umapScheduleNodeScheduleColumns(other._umapScheduleNodeScheduleColumns),
+	_constrTotalNumberVehicles(other._constrTotalNumberVehicles),
+	_constrTotalNumberTripsUnassigned(other._constrTotalNumberTripsUnassigned),
+	_vecConstrOneSchedulePerVehicle(other._vecConstrOneSchedulePerVehicle),
+	_vecConstrTripCoverage(other._vecConstrTripCoverage),
+	_vecConstrOneVehiclePerMaintenance(other._vecConstrOneVehiclePerMaintenance),
+	_vecConstrChargerCapacity(other._vecConstrChargerCapacity),
+	_mseconds_runtimeSolver(other._mseconds_runtimeSolver),
+	_mseconds_filterVars(other._mseconds_filterVars),
+	_VAR_SCHEDULES_START(other._VAR_SCHEDULES_START),
+	_countSolvesSinceCleanUp(other._countSolvesSinceCleanUp),
+	_flagIntegerObjective(other._flagIntegerObjective),
+	_nr_threads(1)
+{
+	// All columns of the copy are known to the other master problem:
+	for (auto& vecVehicleSchedules : _vecVarVehicleSchedules)
+		for (auto& varSchedule : vecVehicleSchedules)
+			varSchedule.isSynced = true;
+
+	// The copies are solved concurrently, hence each HiGHS instance and column pool runs serial:
+	_initialiseSolverOptions();
+	_columnPool.set_nr_threads(_nr_threads);
+
+	// Pass the current lp on to Highs, and warm start from the basis of the other model:
+	_model.passModel(other._model.getLp());
+	if (other._model.getBasis().valid)
+		_model.setBasis(other._model.getBasis());
+}
+
+void eva::MasterProblem::_initialiseSolverOptions()
 {
 	// Set environment parameters. 
 	_model.setOptionValue("output_flag", false);
@@ -32,9 +103,15 @@ void eva::MasterProblem::_initialise()
 	_model.setOptionValue("parallel", "off");
 	_model.setOptionValue("threads", static_cast<HighsInt>(1));
 #else
-	_model.setOptionValue("parallel", "choose");
-	_model.setOptionValue("threads", static_cast<HighsInt>(_optinput.get_config().get_const_nr_threads()));
+	_model.setOptionValue("parallel", _nr_threads > 1 ? "choose" : "off");
+	_model.setOptionValue("threads", static_cast<HighsInt>(_nr_threads));
 #endif
+}
+
+void eva::MasterProblem::_initialise()
+{
+	_initialiseSolverOptions();
+	_flagIntegerObjective = HelperMP::hasIntegerCosts(_optinput);
 
 	// Set general model features:
 	// Columns are later added to the lp.
@@ -68,26 +145,24 @@ void eva::MasterProblem::_updateCurrentDuals()
 		// 3. Constraints: OneVehicleMaintenance
 		for (Types::Index idxConstr = 0; idxConstr < _currentDuals.vecDualsOneVehiclePerMaintenance.size(); idxConstr++)
 			_currentDuals.vecDualsOneVehiclePerMaintenance[idxConstr] = _getDual(_vecConstrOneVehiclePerMaintenance[idxConstr].get_constr());
+
+		// 3b. Constraints: Total Number of Vehicles and Trips Unassigned. Not required for pricing, but for the lagrangian bound:
+		_currentDuals.dualTotalNumberVehicles = _getDual(_constrTotalNumberVehicles.get_constr());
+		_currentDuals.dualTotalNumberTripsUnassigned = _getDual(_constrTotalNumberTripsUnassigned.get_constr());
 	
-		// 4. Constraints: Cumulative Sum of Duals Charger Capacity
+		// 4. Constraints: Prefix Sum of Duals Charger Capacity
 		double cumSum = 0.0;
-		double chargerDual = 0.0;
-		for (Types::Index idxCharger = 0; idxCharger < _currentDuals.vecCumSumDualsChargerCapacity.size(); idxCharger++)
+		for (Types::Index idxCharger = 0; idxCharger < _currentDuals.vecPrefixSumDualsChargerCapacity.size(); idxCharger++)
 		{
-			for (Types::Index idxConstrPO = 0; idxConstrPO < _currentDuals.vecCumSumDualsChargerCapacity[idxCharger].size(); ++idxConstrPO)
+			cumSum = 0.0;
+			for (Types::Index idxConstr = 0; idxConstr + 1 < _currentDuals.vecPrefixSumDualsChargerCapacity[idxCharger].size(); ++idxConstr)
 			{
-				cumSum = 0.0;
-				for (Types::Index idxConstrTO = idxConstrPO; idxConstrTO < _currentDuals.vecCumSumDualsChargerCapacity[idxCharger][idxConstrPO].size(); ++idxConstrTO)
-				{
-					// Only if the constraint was actually included in the model, check the dual:
-					
-					if(_getConstrChargerCapacity(idxCharger, idxConstrTO).is_in_RMP())
-						cumSum += _getDual(_getConstrChargerCapacity(idxCharger, idxConstrTO).get_constr());
+				// Only if the constraint was actually included in the model, check the dual:
+				if(_getConstrChargerCapacity(idxCharger, idxConstr).is_in_RMP())
+					cumSum += _getDual(_getConstrChargerCapacity(idxCharger, idxConstr).get_constr());
 
-					_currentDuals.vecCumSumDualsChargerCapacity[idxCharger][idxConstrPO][idxConstrTO] = cumSum;
-				}
+				_currentDuals.vecPrefixSumDualsChargerCapacity[idxCharger][idxConstr + 1] = cumSum;
 			}
-				
 		}
 	}
 	else
@@ -101,9 +176,38 @@ const double& eva::MasterProblem::_getDual(const HighsInt& constr)
 	return _currentHighsSolution.row_dual[constr];
 }
 
+std::vector<double> eva::MasterProblem::_getRowDuals(const Duals& duals) const
+{
+	// Map the duals back onto the rows of the RMP:
+	std::vector<double> vecRowDuals(_model.getNumRow(), 0.0);
+
+	vecRowDuals[_constrTotalNumberVehicles.get_constr()] = duals.dualTotalNumberVehicles;
+	vecRowDuals[_constrTotalNumberTripsUnassigned.get_constr()] = duals.dualTotalNumberTripsUnassigned;
+
+	for (Types::Index idxConstr = 0; idxConstr < duals.vecDualsOneSchedulePerVehicle.size(); idxConstr++)
+		vecRowDuals[_vecConstrOneSchedulePerVehicle[idxConstr].get_constr()] = duals.vecDualsOneSchedulePerVehicle[idxConstr];
+
+	for (Types::Index idxConstr = 0; idxConstr < duals.vecDualsTripCoverage.size(); idxConstr++)
+		vecRowDuals[_vecConstrTripCoverage[idxConstr].get_constr()] = duals.vecDualsTripCoverage[idxConstr];
+
+	for (Types::Index idxConstr = 0; idxConstr < duals.vecDualsOneVehiclePerMaintenance.size(); idxConstr++)
+		vecRowDuals[_vecConstrOneVehiclePerMaintenance[idxConstr].get_constr()] = duals.vecDualsOneVehiclePerMaintenance[idxConstr];
+
+	for (Types::Index idxCharger = 0; idxCharger < _vecConstrChargerCapacity.size(); idxCharger++)
+	{
+		for (Types::Index idxConstr = 0; idxConstr < _vecConstrChargerCapacity[idxCharger].size(); ++idxConstr)
+		{
+			if (_getConstrChargerCapacity(idxCharger, idxConstr).is_in_RMP())
+				vecRowDuals[_getConstrChargerCapacity(idxCharger, idxConstr).get_constr()] = duals.get_sumDualsChargerCapacity(idxCharger, idxConstr, idxConstr);
+		}
+	}
+
+	return vecRowDuals;
+}
+
 void eva::MasterProblem::_updateSolutionStatus()
 {
-	auto cur_basis = _model.getBasis();
+	const HighsBasis& cur_basis = _model.getBasis();
 
 	// Check all variables of the model if they are integer values:
 	if (_currentHighsSolution.value_valid)
@@ -123,8 +227,21 @@ void eva::MasterProblem::_updateSolutionStatus()
 
 				// Update the basis status of the variable:
 				varSchedule.set_basisStatus(cur_basis.col_status[varSchedule.get_var()]);
+
+				// Update the history of the column, used to select the columns for the clean-up:
+				if (varSchedule.get_basisStatus() == HighsBasisStatus::kBasic)
+					varSchedule.age = 0;
+				else
+					++varSchedule.age;
+
+				if (_currentHighsSolution.dual_valid && Helper::compare_floats_smaller(0.0, _currentHighsSolution.col_dual[varSchedule.get_var()]))
+					++varSchedule.countPositiveRc;
+				else
+					varSchedule.countPositiveRc = 0;
 			}
 		}
+
+		++_countSolvesSinceCleanUp;
 	}
 	else
 	{
@@ -135,49 +252,38 @@ void eva::MasterProblem::_updateSolutionStatus()
 void eva::MasterProblem::_clean_up(const uint32_t& numberDelete)
 {
 	// Filter out "numberDelete" amount of columns that must be deleted.
-	// a. Find the threshold rc.
-	double threshold_rc = -Constants::BIG_DOUBLE;
-	double rc = 0.0;
+	// Basic columns are never removed, hence the basis remains valid after the deletion.
+	// a. Collect the non-basic columns:
+	const HighsBasis& cur_basis = _model.getBasis();
 	std::vector<Variable<SubVehicleSchedule>*> vecDeleteVars;
-	auto cur_basis = _model.getBasis();
-
 	for (auto& vecVehicleSchedules : _vecVarVehicleSchedules)
 	{
 		for (auto& varSchedule : vecVehicleSchedules)
 		{
-			if(vecDeleteVars.size() < numberDelete && cur_basis.col_status[varSchedule.get_var()] != HighsBasisStatus::kBasic)
-			{
-				// Must never remove basic variables, even if the rmp is too big otherwise
-				// Haven't reached the full size of the delete vector yet:
+			if (cur_basis.col_status[varSchedule.get_var()] != HighsBasisStatus::kBasic)
 				vecDeleteVars.push_back(&varSchedule);
-			}
-			else
-			{
-				// Else, find the variable with the minimum reduced cost to leave the vector of deleted variables:
-				threshold_rc = Constants::BIG_DOUBLE;
-				Types::Index idxMin = 0;
-				for(Types::Index idxDel = 0; idxDel < vecDeleteVars.size(); ++idxDel)
-				{
-					rc = _currentHighsSolution.col_dual[vecDeleteVars[idxDel]->get_var()];
-					if(Helper::compare_floats_smaller(rc, threshold_rc)
-						|| (Helper::compare_floats_equal(rc, threshold_rc)
-						&& vecDeleteVars[idxDel]->get_var() > vecDeleteVars[idxMin]->get_var()))
-					{
-						threshold_rc = rc;
-						idxMin = idxDel;
-					}
-				}
-
-				// Now, compare, and check if the variables rc is better than the best threshold at the moment:
-				rc = _currentHighsSolution.col_dual[varSchedule.get_var()];
-				if (Helper::compare_floats_smaller(threshold_rc, rc) || (Helper::compare_floats_equal(rc, threshold_rc) && varSchedule.get_var() < vecDeleteVars[idxMin]->get_var()))
-				{
-					vecDeleteVars[idxMin] = &varSchedule;
-				}
-			}
 		}
 	}
 
+	// b. Select the columns with the longest history of positive reduced costs, then the longest time since they were basic, 
+	// and then the largest reduced cost:
+	if (vecDeleteVars.size() > numberDelete)
+	{
+		std::nth_element(vecDeleteVars.begin(), vecDeleteVars.begin() + numberDelete, vecDeleteVars.end(),
+			[&](const Variable<SubVehicleSchedule>* lhs, const Variable<SubVehicleSchedule>* rhs)
+			{
+				if (lhs->countPositiveRc != rhs->countPositiveRc)
+					return lhs->countPositiveRc > rhs->countPositiveRc;
+				if (lhs->age != rhs->age)
+					return lhs->age > rhs->age;
+
+				const double rcLhs = _currentHighsSolution.col_dual[lhs->get_var()];
+				const double rcRhs = _currentHighsSolution.col_dual[rhs->get_var()];
+				return rcLhs > rcRhs || (rcLhs == rcRhs && lhs->get_var() > rhs->get_var());
+			});
+		vecDeleteVars.resize(numberDelete);
+	}
+
 	// For all variables in the delete vector, set the flag to delete, and remove from highs:
 	std::vector<HighsInt> vecDeleteStatus(_model.getNumCols(), 0);
 	for(auto& ptrVarSchedule : vecDeleteVars)
@@ -185,14 +291,17 @@ void eva::MasterProblem::_clean_up(const uint32_t& numberDelete)
 		vecDeleteStatus[ptrVarSchedule->get_var()] = 1;
 		ptrVarSchedule->flagDelete = true;
 
-		// Store the schedule in the pool of schedules:
-		store_schedule_in_pool(*ptrVarSchedule->get_ptr());
+		// Store the schedule in the pool of schedules. It is moved, unless a copy of the master problem still shares it:
+		if (ptrVarSchedule->get_ptr().use_count() == 1)
+			_columnPool.push_back(std::move(*ptrVarSchedule->get_ptr()));
+		else
+			store_schedule_in_pool(*ptrVarSchedule->get_ptr());
 	}
 	vecDeleteVars.clear(); // Clear the pointers
 
 	// Then, remove the variables:
 	// All variables receive either the new updated index, or 0/-1 to indicate they have been deleted.
-	HighsBasis oldBasis = _model.getBasis();
+	// HiGHS removes the entries of the deleted columns from its basis in place.
 	_model.deleteCols(&vecDeleteStatus[0]);
 
 	// Finally, delete the variable from the vector, and update the index for all remaining ones:
@@ -200,34 +309,155 @@ void eva::MasterProblem::_clean_up(const uint32_t& numberDelete)
 	uint32_t counter_removed = 0;
 #endif // DEBUG_BUILD
 
-	// Use to reset the basis:
-	HighsBasis updatedBasis = _model.getBasis();
 	for (auto& vecVehicleSchedules : _vecVarVehicleSchedules)
 	{
-		for (auto iter = vecVehicleSchedules.begin(); iter != vecVehicleSchedules.end();)
-		{
-			// Update if index for schedule is larger than 0:
-			if (iter->flagDelete)
-			{
-				iter = vecVehicleSchedules.erase(iter);
+		auto iterRemoved = std::remove_if(vecVehicleSchedules.begin(), vecVehicleSchedules.end(), [](const Variable<SubVehicleSchedule>& varSchedule) { return varSchedule.flagDelete; });
 #ifdef DEBUG_BUILD
-				++counter_removed;
+		counter_removed += std::distance(iterRemoved, vecVehicleSchedules.end());
 #endif // DEBUG_BUILD
-			}
+		vecVehicleSchedules.erase(iterRemoved, vecVehicleSchedules.end());
+
+		for (auto& varSchedule : vecVehicleSchedules)
+			varSchedule.set_var(vecDeleteStatus[varSchedule.get_var()]);
+	}
+
+	// Only if HiGHS has invalidated the basis, it is restored from the stored basis status of the columns:
+	if (!_model.getBasis().valid)
+	{
+		HighsBasis updatedBasis = _model.getBasis();
+		for (const auto& vecVehicleSchedules : _vecVarVehicleSchedules)
+			for (const auto& varSchedule : vecVehicleSchedules)
+				updatedBasis.col_status[varSchedule.get_var()] = varSchedule.get_basisStatus();
+		_model.setBasis(updatedBasis);
+	}
+
+	// The positions of the remaining columns have shifted, hence the column indexes are rebuilt:
+	_rebuildScheduleColumnIndexes();
+	_countSolvesSinceCleanUp = 0;
+
+#ifdef DEBUG_BUILD
+	std::cout << "Clean-up removed " << counter_removed << " columns." << std::endl;
+#endif // DEBUG_BUILD
+}
+
+const bool eva::MasterProblem::_isExcludedBy(const BranchKey& key, const SubVehicleSchedule& schedule) const
+{
+	// The schedules of the branch vehicle must match the branch value (bitwise XOR):
+	// A) Schedule includes the activity but shouldn't.
+	// B) Schedule doesn't include the activity but should.
+	// The schedules of other vehicles are only excluded, if the activity is fixed to the branch vehicle.
+	const bool isBranchVehicle = schedule.indexVehicle == key.indexVehicle;
+
+	switch (key.type)
+	{
+	case BranchType::TRIP_UNASSIGNED:
+		return schedule.hasTrip(key.indexElement);
+
+	case BranchType::VEHICLE_TRIP:
+		return isBranchVehicle ? key.value ^ schedule.hasTrip(key.indexElement) : key.value && schedule.hasTrip(key.indexElement);
+
+	case BranchType::VEHICLE_MAINTENANCE:
+		return isBranchVehicle ? key.value ^ schedule.hasMaintenance(key.indexElement) : key.value && schedule.hasMaintenance(key.indexElement);
+
+	case BranchType::VEHICLE_CHARGING_AFTER:
+		return isBranchVehicle ? key.value ^ schedule.hasChargingAfter(key.indexCharger, key.indexElement) : key.value && schedule.hasScheduleNode(key.indexElement);
+
+	case BranchType::VEHICLE_CHARGING_BEFORE:
+		return isBranchVehicle ? key.value ^ schedule.hasChargingBefore(key.indexCharger, key.indexElement) : key.value && schedule.hasScheduleNode(key.indexElement);
+
+	default:
+		return false;
+	}
+}
+
+void eva::MasterProblem::_updateExclusions(const BranchKey& key, const bool apply, std::vector<ScheduleColumnRef>& vecUpdatedColumns)
+{
+	auto updateColumn = [&](const ScheduleColumnRef& ref)
+	{
+		Variable<SubVehicleSchedule>& varSchedule = _vecVarVehicleSchedules[ref.indexVehicle][ref.pos];
+		if (_isExcludedBy(key, *varSchedule.get_ptr()))
+		{
+			if (apply)
+				++varSchedule.countExclusions;
 			else
+				--varSchedule.countExclusions;
+
+			vecUpdatedColumns.push_back(ref);
+		}
+	};
+
+	// 1. All schedules of the branch vehicle:
+	if (key.indexVehicle != Constants::BIG_INDEX)
+	{
+		for (Types::Index pos = 0; pos < _vecVarVehicleSchedules[key.indexVehicle].size(); ++pos)
+			updateColumn(ScheduleColumnRef{ key.indexVehicle, pos });
+	}
+
+	// 2. The schedules of the other vehicles that include the fixed activity:
+	if (key.value)
+	{
+		const std::vector<ScheduleColumnRef>* ptrVecColumns = nullptr;
+		switch (key.type)
+		{
+		case BranchType::TRIP_UNASSIGNED:
+		case BranchType::VEHICLE_TRIP:
+			ptrVecColumns = &_vecTripScheduleColumns[key.indexElement];
+			break;
+
+		case BranchType::VEHICLE_MAINTENANCE:
+			ptrVecColumns = &_vecMaintenanceScheduleColumns[key.indexElement];
+			break;
+
+		case BranchType::VEHICLE_CHARGING_AFTER:
+		case BranchType::VEHICLE_CHARGING_BEFORE:
+		{
+			auto iterColumns = _umapScheduleNodeScheduleColumns.find(key.indexElement);
+			if (iterColumns != _umapScheduleNodeScheduleColumns.end())
+				ptrVecColumns = &iterColumns->second;
+		}
+		break;
+
+		default:
+			break;
+		}
+
+		if (ptrVecColumns != nullptr)
+		{
+			for (const ScheduleColumnRef& ref : *ptrVecColumns)
 			{
-				iter->set_var(vecDeleteStatus[iter->get_var()]);
-				updatedBasis.col_status[iter->get_var()] = iter->get_basisStatus();
-				++iter;
+				if (ref.indexVehicle != key.indexVehicle)
+					updateColumn(ref);
 			}
 		}
 	}
+}
 
-	_model.setBasis(updatedBasis);
+void eva::MasterProblem::_indexScheduleColumn(const Types::Index& indexVehicle, const Types::Index& pos)
+{
+	const ScheduleColumnRef ref{ indexVehicle, pos };
+	const SubVehicleSchedule& schedule = *_vecVarVehicleSchedules[indexVehicle][pos].get_ptr();
 
-#ifdef DEBUG_BUILD
-	std::cout << "Clean-up removed " << counter_removed << " columns." << std::endl;
-#endif // DEBUG_BUILD
+	for (const Types::Index& indexTrip : schedule.vecTripNodeIndexes)
+		_vecTripScheduleColumns[indexTrip].push_back(ref);
+
+	for (const Types::Index& indexMaintenance : schedule.vecMaintenanceNodesIndexes)
+		_vecMaintenanceScheduleColumns[indexMaintenance].push_back(ref);
+
+	for (const BoostScheduleNode& scheduleNode : schedule.vecScheduleNodes)
+		_umapScheduleNodeScheduleColumns[scheduleNode].push_back(ref);
+}
+
+void eva::MasterProblem::_rebuildScheduleColumnIndexes()
+{
+	for (auto& vecColumns : _vecTripScheduleColumns)
+		vecColumns.clear();
+	for (auto& vecColumns : _vecMaintenanceScheduleColumns)
+		vecColumns.clear();
+	_umapScheduleNodeScheduleColumns.clear();
+
+	for (Types::Index indexVehicle = 0; indexVehicle < _vecVarVehicleSchedules.size(); ++indexVehicle)
+		for (Types::Index pos = 0; pos < _vecVarVehicleSchedules[indexVehicle].size(); ++pos)
+			_indexScheduleColumn(indexVehicle, pos);
 }
 
 std::vector<eva::Branch> eva::MasterProblem::get_vecBranchOptions()
@@ -289,6 +519,26 @@ eva::Solution eva::MasterProblem::get_currentSolution()
 	return sol;
 }
 
+std::vector<eva::SubVehicleSchedule> eva::MasterProblem::get_vecActiveSchedules() const
+{
+	std::vector<SubVehicleSchedule> vecSchedules;
+
+	// Collect the schedules with a positive value in the current solution:
+	if (_currentHighsSolution.value_valid)
+	{
+		for (const auto& vecVehicleSchedules : _vecVarVehicleSchedules)
+		{
+			for (const auto& varSchedule : vecVehicleSchedules)
+			{
+				if (Helper::compare_floats_smaller(0.0, _currentHighsSolution.col_value[varSchedule.get_var()]))
+					vecSchedules.push_back(*(varSchedule.get_ptr()));
+			}
+		}
+	}
+
+	return vecSchedules;
+}
+
 const std::vector<std::pair<double, double>> eva::MasterProblem::get_vecLookupColumnBounds() const
 {
 	std::vector<std::pair<double, double>> res(_model.getNumCols());
@@ -382,30 +632,25 @@ void eva::MasterProblem::filterVars(const BranchNode& brn)
 	// Measure time of the function:
 	std::chrono::high_resolution_clock::time_point startClock = std::chrono::high_resolution_clock::now();
 
-	// 1. Quick reset the variables and constraints:
+	// 1. Quick reset the constraints:
 	// a. Total Vehicles Constraint:
 	_model.changeRowBounds(_constrTotalNumberVehicles.get_constr(), -kHighsInf, _optinput.get_vehicles().get_vec().size());
 
 	// b. Total Trips Unassigned Constraint:
 	_model.changeRowBounds(_constrTotalNumberTripsUnassigned.get_constr(), -kHighsInf, _optinput.get_vecTrips().size());
 
-	// b. Vehicles Selected:
-	for (const auto& var : _vecVarVehicleSelected)
-		_model.changeColBounds(var.get_var(), 0.0, 1.0);
-
-	// c. Trips unassigned:
-	for (const auto& var : _vecVarUnallocatedTrips)
-		_model.changeColBounds(var.get_var(), 0.0, 1.0);
-
-	// d. Vehicle Schedules:
-	for (auto& vecVehicleSchedules : _vecVarVehicleSchedules)
-		for (auto& varSchedule : vecVehicleSchedules)
-			_model.changeColBounds(varSchedule.get_var(), 0.0, kHighsInf);
-	
+	// 2. Determine the bounds of the constraints and the auxiliary columns according to the branches:
+	std::vector<std::pair<double, double>> vecBoundsVehicleSelected(_vecVarVehicleSelected.size(), std::make_pair(0.0, 1.0));
+	std::vector<std::pair<double, double>> vecBoundsUnallocatedTrips(_vecVarUnallocatedTrips.size(), std::make_pair(0.0, 1.0));
+	std::vector<BranchKey> vecKeys;
+	vecKeys.reserve(brn.get_vecBranches().size());
 
-	// 2. Now that the model is reset, change the bounds according to the branches:
 	for (const Branch& branch : brn.get_vecBranches())
 	{
+		const BranchKey key = get_branchKey(branch);
+		if (key.type != BranchType::UNDEFINED)
+			vecKeys.push_back(key);
+
 		switch (branch.get_type())
 		{
 		case BranchType::TOTAL_VEHICLES:
@@ -429,214 +674,86 @@ void eva::MasterProblem::filterVars(const BranchNode& brn)
 		break; 
 
 		case BranchType::VEHICLE_ROTATION:
-		{
-			_model.changeColBounds(_vecVarVehicleSelected[branch.castBranchVehicleRotation()->get_vehicle().get_index()].get_var(), branch.get_branchValue(), branch.get_branchValue());
-		}
-		break;
+			vecBoundsVehicleSelected[branch.castBranchVehicleRotation()->get_vehicle().get_index()] = std::make_pair(branch.get_branchValue(), branch.get_branchValue());
+			break;
 
 		case BranchType::TRIP_UNASSIGNED:
-		{
-			const BranchTripUnassigned* btu = branch.castBranchTripUnassigned();
-
-			// If a trip is fixed to be unassigned, then all schedules including the trip can be removed as they will never be included in a solution.
-			if(branch.get_branchValueBool())
-			{
-				for (const Vehicle &vehicle : _optinput.get_vehicles().get_vec())
-				{
-					for (auto &varSchedule : _vecVarVehicleSchedules[vehicle.get_index()])
-					{
-						if (varSchedule.get_ptr()->hasTrip(btu->get_subTripNodeData().get_index()))
-						{
-							// The schedule is not relevant for this branching node:
-							_model.changeColBounds(varSchedule.get_var(), 0.0, 0.0);
-						}
-					}
-				}
-			}
-
-			// Finally, set the fixed bounds of the unallocated trip variable:
-			_model.changeColBounds(_vecVarUnallocatedTrips[btu->get_subTripNodeData().get_index()].get_var(), branch.get_branchValue(), branch.get_branchValue());
-		}
-		break;
+			vecBoundsUnallocatedTrips[branch.castBranchTripUnassigned()->get_subTripNodeData().get_index()] = std::make_pair(branch.get_branchValue(), branch.get_branchValue());
+			break;
 
 		case BranchType::VEHICLE_CHARGING_AFTER:
-			{
-				const BranchVehicleChargingAfter* bvca = branch.castBranchVehicleChargingAfter();
+		case BranchType::VEHICLE_CHARGING_BEFORE:
+		case BranchType::VEHICLE_TRIP:
+		case BranchType::VEHICLE_MAINTENANCE:
+			// If the vehicle is fixed to the activity, it must select a schedule:
+			if (branch.get_branchValueBool())
+				vecBoundsVehicleSelected[key.indexVehicle] = std::make_pair(1.0, 1.0);
+			break;
 
-				for (const Vehicle &vehicle : _optinput.get_vehicles().get_vec())
-				{
-					for (auto &varSchedule : _vecVarVehicleSchedules[vehicle.get_index()])
-					{
-						if (vehicle.get_index() == bvca->get_vehicle().get_index())
-						{
-							// Check if the vehicle has charging after the schedule node:
-							// Bitwise XOR: 
-							// A) Schedule includes charging but shouldn't.
-							// B) Schedule doesn't include charging but should.
-							if (branch.get_branchValueBool() ^
-								varSchedule.get_ptr()->hasChargingAfter(bvca->get_charger().get_index(),bvca->get_indexFromScheduleNode()))
-							{
-								// The schedule is not relevant for this branching node:
-								_model.changeColBounds(varSchedule.get_var(), 0.0, 0.0);
-							}
-						}
-						else
-						{
-							if (branch.get_branchValueBool())
-							{
-								// Check if the schedule has a schedule node that is fixed to another vehicle:
-								// These schedules can no longer be feasible, and hence can be discarded.
-								if (varSchedule.get_ptr()->hasScheduleNode(bvca->get_indexFromScheduleNode()))
-								{
-									// The schedule is not relevant for this branching node:
-									_model.changeColBounds(varSchedule.get_var(), 0.0, 0.0);
-								}
-							}
-						}
-					}
-				}
+		default:
+			break;
+		}
+	}
 
-				// Finally, since the vehicle is fixed to the charging, it must select a schedule:
-				if (branch.get_branchValueBool())
-					_model.changeColBounds(_vecVarVehicleSelected[bvca->get_vehicle().get_index()].get_var(), 1.0, 1.0);
-			}
-		break;
+	// 3. Update the exclusions of the schedule columns. Subsequent branch nodes mostly share the leading branches, 
+	// hence only the applied branches behind the common prefix are rolled back, and only the remaining branches of the node are applied.
+	// The columns affected by a branch are found by its vehicle, and by the trip, maintenance or schedule node it fixes:
+	std::vector<ScheduleColumnRef> vecUpdatedColumns;
 
-		case BranchType::VEHICLE_CHARGING_BEFORE:
-		{
-			// Differ approach between branch being 1 or 0:
-			const BranchVehicleChargingBefore* bvcb = branch.castBranchVehicleChargingBefore();
+	size_t sizePrefix = 0;
+	while (sizePrefix < vecKeys.size() && sizePrefix < _vecAppliedBranches.size() && _vecAppliedBranches[sizePrefix] == vecKeys[sizePrefix])
+		++sizePrefix;
 
-			// Iterate over all vehicle schedules of the branches vehicle, and check if they have the charging activity:
-			for(const Vehicle& vehicle : _optinput.get_vehicles().get_vec())
-			{
-				for (auto& varSchedule : _vecVarVehicleSchedules[vehicle.get_index()])
-				{
-					if(vehicle.get_index() == bvcb->get_vehicle().get_index())
-					{
-						// Check if the vehicle has charging after the schedule node:
-						// Bitwise XOR:
-						// A) Schedule includes charging but shouldn't.
-						// B) Schedule doesn't include charging but should.
-						if (branch.get_branchValueBool() ^
-							varSchedule.get_ptr()->hasChargingBefore(bvcb->get_charger().get_index(), bvcb->get_indexToScheduleNode()))
-						{
-							// The schedule is not relevant for this branching node:
-							_model.changeColBounds(varSchedule.get_var(), 0.0, 0.0);
-						}
-					}
-					else
-					{
-						if (branch.get_branchValueBool())
-						{
-							// Check if the schedule has a schedule node that is fixed to another vehicle:
-							// These schedules can no longer be feasible, and hence can be discarded.
-							if (varSchedule.get_ptr()->hasScheduleNode(bvcb->get_indexToScheduleNode()))
-							{
-								// The schedule is not relevant for this branching node:
-								_model.changeColBounds(varSchedule.get_var(), 0.0, 0.0);
-							}
-						}
-					}					
-				}
-			}
+	while (_vecAppliedBranches.size() > sizePrefix)
+	{
+		_updateExclusions(_vecAppliedBranches.back(), false, vecUpdatedColumns);
+		_vecAppliedBranches.pop_back();
+	}
 
-			// Finally, since the vehicle is fixed to the charging, it must select a schedule:
-			if(branch.get_branchValueBool())
-				_model.changeColBounds(_vecVarVehicleSelected[bvcb->get_vehicle().get_index()].get_var(), 1.0, 1.0);
-		}
-			break;
+	for (size_t posKey = sizePrefix; posKey < vecKeys.size(); ++posKey)
+	{
+		_updateExclusions(vecKeys[posKey], true, vecUpdatedColumns);
+		_vecAppliedBranches.push_back(vecKeys[posKey]);
+	}
 
-		case BranchType::VEHICLE_TRIP:
+	// 4. Collect the columns whose bounds change, and push them to HiGHS with a single call:
+	const HighsLp& lp = _model.getLp();
+	std::vector<HighsInt> vecCols;
+	std::vector<double> vecLb;
+	std::vector<double> vecUb;
+	auto addBounds = [&](const HighsInt& col, const double& lb, const double& ub)
+	{
+		if (lp.col_lower_[col] != lb || lp.col_upper_[col] != ub)
 		{
-			const BranchVehicleTrip* bvt = branch.castBranchVehicleTrip();
-
-			// Iterate over all vehicle schedules of the branches vehicle, and check if they have the charging activity:
-			for (const Vehicle &vehicle : _optinput.get_vehicles().get_vec())
-			{
-				for (auto &varSchedule : _vecVarVehicleSchedules[vehicle.get_index()])
-				{
-					if (vehicle.get_index() == bvt->get_vehicle().get_index())
-					{
-						// Bitwise XOR:
-						// A) Schedule includes trip but shouldn't.
-						// B) Schedule doesn't include trip but should.
-						if (branch.get_branchValueBool() ^
-							varSchedule.get_ptr()->hasTrip(bvt->get_subTripNodeData().get_index()))
-						{
-							// The schedule is not relevant for this branching node:
-							_model.changeColBounds(varSchedule.get_var(), 0.0, 0.0);
-						}
-					}
-					else
-					{
-						if (branch.get_branchValueBool())
-						{
-							// Check if the trip is included in any other vehicle schedule. These must be irrelevant for the solution.
-							if (varSchedule.get_ptr()->hasTrip(bvt->get_subTripNodeData().get_index()))
-							{
-								// The schedule is not relevant for this branching node:
-								_model.changeColBounds(varSchedule.get_var(), 0.0, 0.0);
-							}
-						}
-					}
-				}
-			}
-		
-			// Finally, since the vehicle is fixed to the trip, it must select a schedule:
-			if (branch.get_branchValueBool())
-				_model.changeColBounds(_vecVarVehicleSelected[bvt->get_vehicle().get_index()].get_var(), 1.0, 1.0);
+			vecCols.push_back(col);
+			vecLb.push_back(lb);
+			vecUb.push_back(ub);
 		}
-		break;
+	};
 
-		case BranchType::VEHICLE_MAINTENANCE:
-		{
-			const BranchVehicleMaintenance* bvm = branch.castBranchVehicleMaintenance();
+	// a. Vehicles Selected:
+	for (const auto& var : _vecVarVehicleSelected)
+		addBounds(var.get_var(), vecBoundsVehicleSelected[var.get_ptr()->get_index()].first, vecBoundsVehicleSelected[var.get_ptr()->get_index()].second);
 
-			// Iterate over all vehicle schedules of the branches vehicle, and check if they have the charging activity:
-			for (const Vehicle &vehicle : _optinput.get_vehicles().get_vec())
-			{
-				for (auto &varSchedule : _vecVarVehicleSchedules[vehicle.get_index()])
-				{
-					if (vehicle.get_index() == bvm->get_vehicle().get_index())
-					{
-						// Bitwise XOR: 
-						// A) Schedule includes maintenance but shouldn't.
-						// B) Schedule doesn't include maintenance but should.
-						if (branch.get_branchValueBool() ^
-						varSchedule.get_ptr()->hasMaintenance(bvm->get_subMaintenanceNodeData().get_index()))
-						{
-							// The schedule is not relevant for this branching node:
-							_model.changeColBounds(varSchedule.get_var(), 0.0, 0.0);
-						}
-					}
-					else
-					{
-						if (branch.get_branchValueBool())
-						{
-							// Only if the branch value was "=1" for another vehicle, a maintenance activity has been fixed to another vehicle.
-							// Check if the schedule has a schedule using the same maintenance. This variable will no longer be available:
-							if (varSchedule.get_ptr()->hasMaintenance(bvm->get_subMaintenanceNodeData().get_index()))
-							{
-								// The schedule is not relevant for this branching node:
-								_model.changeColBounds(varSchedule.get_var(), 0.0, 0.0);
-							}
-						}
-					}
-				}
-			}
+	// b. Trips unassigned:
+	for (const auto& var : _vecVarUnallocatedTrips)
+		addBounds(var.get_var(), vecBoundsUnallocatedTrips[var.get_ptr()->get_index()].first, vecBoundsUnallocatedTrips[var.get_ptr()->get_index()].second);
 
-			// Finally, since the vehicle is fixed to the maintenance, it must select a schedule:
-			if (branch.get_branchValueBool())
-				_model.changeColBounds(_vecVarVehicleSelected[bvm->get_vehicle().get_index()].get_var(), 1.0, 1.0);
-		}
-			break;
+	// c. Vehicle Schedules, a column may be updated by several branches:
+	std::sort(vecUpdatedColumns.begin(), vecUpdatedColumns.end(), [](const ScheduleColumnRef& lhs, const ScheduleColumnRef& rhs)
+		{ return lhs.indexVehicle < rhs.indexVehicle || (lhs.indexVehicle == rhs.indexVehicle && lhs.pos < rhs.pos); });
+	vecUpdatedColumns.erase(std::unique(vecUpdatedColumns.begin(), vecUpdatedColumns.end(), [](const ScheduleColumnRef& lhs, const ScheduleColumnRef& rhs)
+		{ return lhs.indexVehicle == rhs.indexVehicle && lhs.pos == rhs.pos; }), vecUpdatedColumns.end());
 
-		default:
-			break;
-		}
+	for (const ScheduleColumnRef& ref : vecUpdatedColumns)
+	{
+		const Variable<SubVehicleSchedule>& varSchedule = _vecVarVehicleSchedules[ref.indexVehicle][ref.pos];
+		addBounds(varSchedule.get_var(), 0.0, varSchedule.countExclusions > 0 ? 0.0 : kHighsInf);
 	}
 
+	if (!vecCols.empty())
+		_model.changeColsBounds(static_cast<HighsInt>(vecCols.size()), &vecCols[0], &vecLb[0], &vecUb[0]);
+
 	_mseconds_filterVars += std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - startClock).count();
 }
 
@@ -724,9 +841,58 @@ void eva::MasterProblem::solveAsMIP()
 	_mseconds_runtimeSolver += std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - startClock).count();
 }
 
+void eva::MasterProblem::_addScheduleColumns(std::vector<SubVehicleSchedule>& vecSchedules, const bool include_cost)
+{
+	// Columns excluded by the applied branches are added with an upper bound of zero:
+	_columnBuffer.clear();
+	std::vector<uint32_t> vecCountExclusions;
+	vecCountExclusions.reserve(vecSchedules.size());
+	for(const SubVehicleSchedule& schedule : vecSchedules)
+	{
+		uint32_t countExclusions = 0;
+		for (const BranchKey& key : _vecAppliedBranches)
+			countExclusions += _isExcludedBy(key, schedule);
+		vecCountExclusions.push_back(countExclusions);
+
+		_columnBuffer.start_column(include_cost * schedule.cost, 0.0, countExclusions > 0 ? 0.0 : kHighsInf);
+
+		// 1. Cstr: One Routing Vehicle:
+		_columnBuffer.add_coefficient(_getConstrOneSchedulePerVehicle(schedule.indexVehicle).get_constr(), 1.0);
+
+		// 2. Cstr: Trip Coverage:
+		for (const Types::Index& indexTrip : schedule.vecTripNodeIndexes)
+			_columnBuffer.add_coefficient(_getConstrTripCoverage(indexTrip).get_constr(), 1.0);
+
+		// 3. Cstr: Maintenance Coverage:
+		for (const Types::Index& indexMaintenance : schedule.vecMaintenanceNodesIndexes)
+			_columnBuffer.add_coefficient(_getConstrOneVehiclePerMaintenance(indexMaintenance).get_constr(), 1.0);
+
+		// 4. Cstr: Charger Capacity
+		for (const ChargingSchedule& chargingSchedule : schedule.vecChargingSchedule)
+		{
+			for (Types::Index indexCharging = chargingSchedule.indexPutOnCharge; indexCharging <= chargingSchedule.indexTakeOffCharge; indexCharging++)
+			{
+				if (_getConstrChargerCapacity(chargingSchedule.indexCharger, indexCharging).is_in_RMP())
+					_columnBuffer.add_coefficient(_getConstrChargerCapacity(chargingSchedule.indexCharger, indexCharging).get_constr(), 1.0);
+			}
+		}
+	}
+
+	// The columns are appended in the order of the schedules:
+	HighsInt indexCol = _addColumns(_columnBuffer);
+	for (Types::Index posSchedule = 0; posSchedule < vecSchedules.size(); ++posSchedule)
+	{
+		const Types::Index indexVehicle = vecSchedules[posSchedule].indexVehicle;
+		_vecVarVehicleSchedules[indexVehicle].push_back(Variable<SubVehicleSchedule>(indexCol++, std::move(vecSchedules[posSchedule])));
+		_vecVarVehicleSchedules[indexVehicle].back().countExclusions = vecCountExclusions[posSchedule];
+		_indexScheduleColumn(indexVehicle, _vecVarVehicleSchedules[indexVehicle].size() - 1);
+	}
+}
+
 eva::StatusVarSchedulesAdded eva::MasterProblem::addVarsSchedule(std::vector<std::vector<SubVehicleSchedule>>& vecSchedules, const bool include_cost)
 {
 	std::vector<SubVehicleSchedule> nonDominatedSchedules;
+	std::unordered_set<size_t> setSignatureHashes;
 	StatusVarSchedulesAdded result;
 	result.lb = this->get_currentObjective();
 
@@ -735,20 +901,27 @@ eva::StatusVarSchedulesAdded eva::MasterProblem::addVarsSchedule(std::vector<std
 	{
 		for (SubVehicleSchedule& schedule : vehicleVecSchedules)
 		{
+			// 1. Skip exact duplicates of a schedule in the current batch. Only on a hash collision, the schedules are compared:
+			schedule.update_signature();
+			if (!setSignatureHashes.insert(schedule.signatureHash).second
+				&& std::any_of(nonDominatedSchedules.begin(), nonDominatedSchedules.end(), [&](const SubVehicleSchedule& other) { return other.isIdenticalTo(schedule); }))
+				continue;
+
 			bool isDominated = false;
 			if (_optinput.get_config().get_flag_use_model_cleanup())
 			{
-				// 2. Check the current batch of new schedules, and only add the ones that are independent:
+				// 2. Check the current batch of new schedules, and only add the ones that are independent.
+				// Most pairs are ruled out by the signature masks, before the schedules are compared:
 				auto iterNonDomSchedules = nonDominatedSchedules.begin();
 				while (iterNonDomSchedules != nonDominatedSchedules.end())
 				{
 					// a. Check if the iternondom is subset of current schedule:
-					if (iterNonDomSchedules->isSubsetOf(schedule) && Helper::compare_floats_smaller_equal(schedule.reducedCost, iterNonDomSchedules->reducedCost))
+					if (iterNonDomSchedules->mayBeSubsetOf(schedule) && iterNonDomSchedules->isSubsetOf(schedule) && Helper::compare_floats_smaller_equal(schedule.reducedCost, iterNonDomSchedules->reducedCost))
 					{
 						// Then, schedule dominates the current pointer, making it irrelevant (at this point in CG):
 						iterNonDomSchedules = nonDominatedSchedules.erase(iterNonDomSchedules);
 					}
-					else if (schedule.isSubsetOf(*iterNonDomSchedules) && Helper::compare_floats_smaller_equal(iterNonDomSchedules->reducedCost, schedule.reducedCost))
+					else if (schedule.mayBeSubsetOf(*iterNonDomSchedules) && schedule.isSubsetOf(*iterNonDomSchedules) && Helper::compare_floats_smaller_equal(iterNonDomSchedules->reducedCost, schedule.reducedCost))
 					{
 						isDominated = true;
 						break;
@@ -774,139 +947,217 @@ eva::StatusVarSchedulesAdded eva::MasterProblem::addVarsSchedule(std::vector<std
 		}
 	}
 	
-	// Before adding the new columns, check if the RMP will be above the feasible limit. 
-	// If yes, delete the columns currently with the worst reduced cost.
+	// Before adding the new columns, clean up the RMP:
+	// a. If the RMP will be above the feasible limit, delete the columns with the worst history.
+	// b. Every n-th solve, delete the columns that repeatedly had a positive reduced cost. These small regular batches keep the RMP from growing until the limit is hit.
 	if (_optinput.get_config().get_flag_use_model_cleanup())
 	{
 		int32_t toDelete = (_model.getNumCols() - _VAR_SCHEDULES_START) + nonDominatedSchedules.size() - _optinput.get_config().get_const_max_number_cols_mp();
+
+		if (_countSolvesSinceCleanUp >= _optinput.get_config().get_const_nth_iter_model_clean())
+		{
+			int32_t countRepeatedPositiveRc = 0;
+			for (const auto& vecVehicleSchedules : _vecVarVehicleSchedules)
+				for (const auto& varSchedule : vecVehicleSchedules)
+					countRepeatedPositiveRc += varSchedule.countPositiveRc >= _optinput.get_config().get_const_del_consecutive_pos_rc();
+
+			toDelete = std::max(toDelete, countRepeatedPositiveRc);
+			_countSolvesSinceCleanUp = 0;
+		}
+
 		if(toDelete > 0)
 			_clean_up(toDelete);
 	}
 
-	// Now, add all the non-dominated schedules:
-	for(const SubVehicleSchedule& schedule : nonDominatedSchedules)
+	// Now, add all the non-dominated schedules to the RMP with a single call:
+	_addScheduleColumns(nonDominatedSchedules, include_cost);
+
+	// Save the added columns
+	result.columnsAdded = nonDominatedSchedules.size();
+
+	return result;
+}
+
+eva::StatusVarSchedulesAdded eva::MasterProblem::addPoolVarsSchedule(const Duals &duals, const BranchNode &brn, const bool include_cost)
+{
+	// Take the previously discovered schedules out of the pool, 
+	// if they have negative reduced cost, and are feasible in the branching node:
+	std::vector<std::vector<SubVehicleSchedule>> vecPoolVars = _columnPool.extract_columns(duals, brn, _optinput.get_config().get_const_nr_cols_per_vehicle_iter() - 1);
+
+#ifdef DEBUG_BUILD
+	uint32_t addedCols = 0;
+	for (const auto& vecVehiclePoolVars : vecPoolVars)
+		addedCols += vecVehiclePoolVars.size();
+	if(addedCols > 0)
+		std::cout << "Pre-qualified Pool Columns Added: " << addedCols << std::endl;
+#endif
+
+	// Finally, re-add the schedules to the RMP:
+    return addVarsSchedule(vecPoolVars, include_cost);
+}
+
+eva::LagrangianEvaluation eva::MasterProblem::evaluate_lagrangian(const Duals& duals, const Duals& direction, const std::vector<std::vector<SubVehicleSchedule>>& vecSchedules) const
+{
+	// The lagrangian function relaxes all rows of the RMP, and keeps the column bounds and "at most one schedule per vehicle":
+	// L(duals) = sum_rows activeBound * dual + sum_auxiliaryColumns activeBound * rc + sum_vehicles min(0, min rc).
+	// The subgradient at the duals is (activeRowBound - A * x), where x is the minimiser of the lagrangian function.
+	LagrangianEvaluation result;
+	double lb = 0.0;
+	double rc = 0.0;
+	double x = 0.0;
+	const HighsLp& lp = _model.getLp();
+	std::vector<double> vecRowDuals = _getRowDuals(duals);
+	std::vector<double> vecRowDirection = _getRowDuals(direction);
+
+	// 1. Rows:
+	for (HighsInt row = 0; row < _model.getNumRow(); ++row)
 	{
-		// -------------------------------
-		// Finally add the schedule:
-		std::vector<HighsInt> row_indices;
-		std::vector<double> row_coefficients;
-		HighsInt number_nonzero_coefficients = 0;
+		x = HelperMP::activeBound(lp.row_lower_[row], lp.row_upper_[row], vecRowDuals[row]);
+		if (HelperMP::isInfinite(x))
+			return LagrangianEvaluation(); // The duals have the wrong sign for this row, no bound can be derived.
 
-		// 1. Cstr: One Routing Vehicle:
-		row_indices.push_back(_getConstrOneSchedulePerVehicle(schedule.indexVehicle).get_constr());
-		row_coefficients.push_back(1.0);
-		number_nonzero_coefficients++;
+		lb += x * vecRowDuals[row];
+		result.subgradientProduct += x * vecRowDirection[row];
+	}
 
-		// 2. Cstr: Trip Coverage:
-		for (const Types::Index& indexTrip : schedule.vecTripNodeIndexes)
-		{
-			row_indices.push_back(_getConstrTripCoverage(indexTrip).get_constr());
-			row_coefficients.push_back(1.0);
-			number_nonzero_coefficients++;
-		}
+	// 2. Auxiliary columns:
+	auto addColumn = [&](const HighsInt& col, const double& coeffDuals, const double& coeffDirection)
+	{
+		rc = lp.col_cost_[col] - coeffDuals;
+		x = HelperMP::activeBound(lp.col_lower_[col], lp.col_upper_[col], rc);
+		lb += x * rc;
+		result.subgradientProduct -= x * coeffDirection;
+	};
 
-		// 3. Cstr: Maintenance Coverage:
-		for (const Types::Index& indexMaintenance : schedule.vecMaintenanceNodesIndexes)
-		{
-			row_indices.push_back(_getConstrOneVehiclePerMaintenance(indexMaintenance).get_constr());
-			row_coefficients.push_back(1.0);
-			number_nonzero_coefficients++;
-		}
+	for (const auto& var : _vecVarVehicleSelected)
+		addColumn(var.get_var(),
+			duals.dualTotalNumberVehicles - duals.vecDualsOneSchedulePerVehicle[var.get_ptr()->get_index()],
+			direction.dualTotalNumberVehicles - direction.vecDualsOneSchedulePerVehicle[var.get_ptr()->get_index()]);
 
-		// 4. Cstr: Charger Capacity
-		for (const ChargingSchedule& chargingSchedule : schedule.vecChargingSchedule)
+	for (const auto& var : _vecVarUnallocatedTrips)
+		addColumn(var.get_var(),
+			duals.dualTotalNumberTripsUnassigned + duals.vecDualsTripCoverage[var.get_ptr()->get_index()],
+			direction.dualTotalNumberTripsUnassigned + direction.vecDualsTripCoverage[var.get_ptr()->get_index()]);
+
+	addColumn(_varsTotalVehiclesSlacks.first.get_var(), duals.dualTotalNumberVehicles, direction.dualTotalNumberVehicles);
+	addColumn(_varsTotalVehiclesSlacks.second.get_var(), -duals.dualTotalNumberVehicles, -direction.dualTotalNumberVehicles);
+	addColumn(_varsTotalTripsUnassignedSlacks.first.get_var(), duals.dualTotalNumberTripsUnassigned, direction.dualTotalNumberTripsUnassigned);
+	addColumn(_varsTotalTripsUnassignedSlacks.second.get_var(), -duals.dualTotalNumberTripsUnassigned, -direction.dualTotalNumberTripsUnassigned);
+
+	// 3. Vehicle schedules, at most one per vehicle:
+	for (const auto& vecVehicleSchedules : vecSchedules)
+	{
+		const SubVehicleSchedule* ptrMinSchedule = nullptr;
+		double minRc = 0.0;
+		for (const SubVehicleSchedule& schedule : vecVehicleSchedules)
 		{
-			for (Types::Index indexCharging = chargingSchedule.indexPutOnCharge; indexCharging <= chargingSchedule.indexTakeOffCharge; indexCharging++)
+			rc = schedule.get_current_reducedCost(duals);
+			if (Helper::compare_floats_smaller(rc, minRc))
 			{
-				if (_getConstrChargerCapacity(chargingSchedule.indexCharger, indexCharging).is_in_RMP())
-				{
-					row_indices.push_back(_getConstrChargerCapacity(chargingSchedule.indexCharger, indexCharging).get_constr());
-					row_coefficients.push_back(1.0);
-					number_nonzero_coefficients++;
-				}
+				minRc = rc;
+				ptrMinSchedule = &schedule;
 			}
 		}
 
-		// Add the schedule to RMP:
-		_vecVarVehicleSchedules[schedule.indexVehicle].push_back(
-			Variable<SubVehicleSchedule>
-		(
-			_addColumn(
-				include_cost * schedule.cost,
-				0.0,
-				kHighsInf,
-				number_nonzero_coefficients,
-				&row_indices[0],
-				&row_coefficients[0]
-			),
-			schedule
-		)
-		);
+		if (ptrMinSchedule != nullptr)
+		{
+			lb += minRc;
+			result.subgradientProduct -= ptrMinSchedule->cost - ptrMinSchedule->get_current_reducedCost(direction);
+		}
 	}
 
-	// Save the added columns
-	result.columnsAdded = nonDominatedSchedules.size();
-
+	result.lb = lb;
 	return result;
 }
 
-eva::StatusVarSchedulesAdded eva::MasterProblem::addPoolVarsSchedule(const Duals &duals, const BranchNode &brn, const bool include_cost)
+void eva::MasterProblem::set_nr_threads(const uint32_t nr_threads)
 {
-	std::vector<std::vector<SubVehicleSchedule>> vecPoolVars(_optinput.get_vehicles().get_vec().size());
+	_nr_threads = std::max(static_cast<uint32_t>(1), nr_threads);
+	_initialiseSolverOptions();
+	_columnPool.set_nr_threads(_nr_threads);
+}
 
-#ifdef DEBUG_BUILD
-	uint32_t addedCols = 0;
-#endif
+void eva::MasterProblem::store_schedule_in_pool(const SubVehicleSchedule &schedule)
+{
+	// Add the deleted schedule to the pool. If the pool is full, the oldest schedule is erased first:
+	_columnPool.push_back(schedule);
+}
 
-	// Iterate through the pool of previoulsy discovered schedules. 
-	// If they have negative reduced cost, and are feasible in the branching node, then add them to the RMP:
-	auto iterPoolVars = _vecPoolVehicleSchedule.begin();
-	while(iterPoolVars != _vecPoolVehicleSchedule.end())
+void eva::MasterProblem::sync_with(const MasterProblem& other)
+{
+	// 1. Charger capacity rows, that were only added to the other master problem:
+	std::vector<std::vector<Types::Index>> vecMissingSlots(_vecConstrChargerCapacity.size());
+	bool hasMissingRows = false;
+	for (Types::Index indexCharger = 0; indexCharger < _vecConstrChargerCapacity.size(); ++indexCharger)
 	{
-		// Check if the schedule has negative reduced cost:
-		if(Helper::compare_floats_smaller(iterPoolVars->get_current_reducedCost(duals),0.0))
+		for (Types::Index indexChargingInterval = 0; indexChargingInterval < _vecConstrChargerCapacity[indexCharger].size(); ++indexChargingInterval)
 		{
-			// Check if the schedule is feasible with the branching node:
-			if(iterPoolVars->isFeasibleInBranchNode(brn))
+			if (other._getConstrChargerCapacity(indexCharger, indexChargingInterval).is_in_RMP() && !_getConstrChargerCapacity(indexCharger, indexChargingInterval).is_in_RMP())
 			{
-				// Check if already the maximum number of schedules have been added for the vehicle:
-				if(vecPoolVars[iterPoolVars->indexVehicle].size() < (_optinput.get_config().get_const_nr_cols_per_vehicle_iter() - 1))
-				{
-#ifdef DEBUG_BUILD
-				++addedCols;
-#endif
-					vecPoolVars[iterPoolVars->indexVehicle].push_back(*iterPoolVars);
-				
-					// Second, delete from the pool of vehicle schedules:
-					iterPoolVars = _vecPoolVehicleSchedule.erase(iterPoolVars);
-	
-					// Continue the loop:
-					continue;
-				}
-
+				vecMissingSlots[indexCharger].push_back(indexChargingInterval);
+				hasMissingRows = true;
 			}
 		}
-		++iterPoolVars;
 	}
 
-#ifdef DEBUG_BUILD
-	if(addedCols > 0)
-		std::cout << "Pre-qualified Pool Columns Added: " << addedCols << std::endl;
-#endif
+	if (hasMissingRows)
+	{
+		_addConstrsChargerCapacity(vecMissingSlots);
+		_currentSolutionStatus = MasterProblemSolutionStatus::MP_UNDEFINED;
+	}
 
-	// Finally, re-add the schedules to the RMP:
-    return addVarsSchedule(vecPoolVars, include_cost);
+	// 2. Schedule columns, that are not in this copy. Only on a hash collision, the schedules are compared:
+	std::unordered_map<size_t, std::vector<const SubVehicleSchedule*>> umapSchedulesBySignature;
+	for (const auto& vecVehicleSchedules : _vecVarVehicleSchedules)
+		for (const auto& varSchedule : vecVehicleSchedules)
+			umapSchedulesBySignature[varSchedule.get_ptr()->signatureHash].push_back(varSchedule.get_ptr().get());
+
+	std::vector<SubVehicleSchedule> vecMissingSchedules;
+	for (const auto& vecVehicleSchedules : other._vecVarVehicleSchedules)
+	{
+		for (const auto& varSchedule : vecVehicleSchedules)
+		{
+			const SubVehicleSchedule& schedule = *varSchedule.get_ptr();
+			auto iterSignature = umapSchedulesBySignature.find(schedule.signatureHash);
+			if (iterSignature == umapSchedulesBySignature.end()
+				|| std::none_of(iterSignature->second.begin(), iterSignature->second.end(), [&](const SubVehicleSchedule* ptrOther) { return ptrOther->isIdenticalTo(schedule); }))
+				vecMissingSchedules.push_back(schedule);
+		}
+	}
+
+	if (vecMissingSchedules.empty())
+		return;
+
+	// The added columns are known to the other master problem, hence are never handed back:
+	std::vector<Types::Index> vecSizesBefore;
+	for (const auto& vecVehicleSchedules : _vecVarVehicleSchedules)
+		vecSizesBefore.push_back(vecVehicleSchedules.size());
+
+	_addScheduleColumns(vecMissingSchedules, true);
+
+	for (Types::Index indexVehicle = 0; indexVehicle < _vecVarVehicleSchedules.size(); ++indexVehicle)
+		for (Types::Index pos = vecSizesBefore[indexVehicle]; pos < _vecVarVehicleSchedules[indexVehicle].size(); ++pos)
+			_vecVarVehicleSchedules[indexVehicle][pos].isSynced = true;
+
+	_currentSolutionStatus = MasterProblemSolutionStatus::MP_UNDEFINED;
 }
 
-void eva::MasterProblem::store_schedule_in_pool(const SubVehicleSchedule &schedule)
+std::vector<eva::SubVehicleSchedule> eva::MasterProblem::extract_unsynced_schedules()
 {
-	// First-in-first-out principle on how to manage the pool schedules.
-	// If the number of items exceeds the queue, erase from the front first:
-	if(_vecPoolVehicleSchedule.size() >= _optinput.get_config().get_const_max_number_cols_mp_pool())
-		_vecPoolVehicleSchedule.pop_front();
+	std::vector<SubVehicleSchedule> result;
+	for (auto& vecVehicleSchedules : _vecVarVehicleSchedules)
+	{
+		for (auto& varSchedule : vecVehicleSchedules)
+		{
+			if (!varSchedule.isSynced)
+			{
+				result.push_back(*varSchedule.get_ptr());
+				varSchedule.isSynced = true;
+			}
+		}
+	}
 
-	// Now, add the deleted schedule to the pool at the back:
-	_vecPoolVehicleSchedule.push_back(schedule);
+	return result;
 }
 
 void eva::MasterProblem::set_aux_variable_bounds()
@@ -986,15 +1237,72 @@ void eva::MasterProblem::reset_variable_bounds(const std::vector<std::pair<doubl
 	_model.changeColBounds(_varsTotalTripsUnassignedSlacks.second.get_var(), vecBounds[_varsTotalTripsUnassignedSlacks.second.get_var()].first, vecBounds[_varsTotalTripsUnassignedSlacks.second.get_var()].second);
 }
 
+void eva::MasterProblem::_addConstrsChargerCapacity(const std::vector<std::vector<Types::Index>>& vecSlotsPerCharger)
+{
+	// a. Position of every new row, per charger and slot:
+	std::vector<std::vector<Types::Index>> vecNewRowPositions(vecSlotsPerCharger.size());
+	Types::Index nrNewRows = 0;
+	for (Types::Index indexCharger = 0; indexCharger < vecSlotsPerCharger.size(); ++indexCharger)
+	{
+		for (Types::Index pos = 0; pos < vecSlotsPerCharger[indexCharger].size(); ++pos)
+			vecNewRowPositions[indexCharger].push_back(nrNewRows++);
+	}
+
+	// b. Collect the columns of every new row. The slots of a charger are sorted, hence the slots within a charging session are found by a binary search:
+	std::vector<std::vector<HighsInt>> vecRowColumns(nrNewRows);
+	for (auto &vecVehicleSchedules : _vecVarVehicleSchedules)
+	{
+		for (auto &varSchedule : vecVehicleSchedules)
+		{
+			for (const ChargingSchedule &chargingSchedule : varSchedule.get_ptr()->vecChargingSchedule)
+			{
+				const std::vector<Types::Index>& vecSlots = vecSlotsPerCharger[chargingSchedule.indexCharger];
+				for (auto iterSlot = std::lower_bound(vecSlots.begin(), vecSlots.end(), chargingSchedule.indexPutOnCharge);
+					iterSlot != vecSlots.end() && *iterSlot <= chargingSchedule.indexTakeOffCharge;
+					++iterSlot)
+				{
+					vecRowColumns[vecNewRowPositions[chargingSchedule.indexCharger][iterSlot - vecSlots.begin()]].push_back(varSchedule.get_var());
+				}
+			}
+		}
+	}
+
+	// c. Add all rows with their coefficients at once:
+	std::vector<double> vecRowLb, vecRowUb;
+	std::vector<HighsInt> vecRowStarts, vecRowIndices;
+	for (Types::Index indexCharger = 0; indexCharger < vecSlotsPerCharger.size(); ++indexCharger)
+	{
+		for (Types::Index pos = 0; pos < vecSlotsPerCharger[indexCharger].size(); ++pos)
+		{
+			const Types::Index& indexChargingInterval = vecSlotsPerCharger[indexCharger][pos];
+			const std::vector<HighsInt>& vecColumns = vecRowColumns[vecNewRowPositions[indexCharger][pos]];
+
+			vecRowLb.push_back(_vecConstrChargerCapacity[indexCharger][indexChargingInterval].get_lb());
+			vecRowUb.push_back(_vecConstrChargerCapacity[indexCharger][indexChargingInterval].get_ub());
+			vecRowStarts.push_back(vecRowIndices.size());
+			vecRowIndices.insert(vecRowIndices.end(), vecColumns.begin(), vecColumns.end());
+		}
+	}
+	std::vector<double> vecRowValues(vecRowIndices.size(), 1.0);
+
+	HighsInt indexRow = _addRows(nrNewRows, vecRowLb.data(), vecRowUb.data(), vecRowIndices.size(), vecRowStarts.data(), vecRowIndices.data(), vecRowValues.data());
+	for (Types::Index indexCharger = 0; indexCharger < vecSlotsPerCharger.size(); ++indexCharger)
+	{
+		for (const auto &indexChargingInterval : vecSlotsPerCharger[indexCharger])
+			_vecConstrChargerCapacity[indexCharger][indexChargingInterval].set_constr(indexRow++);
+	}
+}
+
 bool eva::MasterProblem::check_and_update_charger_capacity(const bool add_rmp_rows)
 {
 	// Check if the charger capacity constraints are all feasible:
 	bool capacities_feasible = true;
 
 	// Step 1: Create the twin-vector of charger capacity to compute the value of how many vehicles are present at the charger:
+	// Each charging session adds its value at the put on charge slot, and removes it after the take off charge slot.
 	std::vector<std::vector<double>> vecVehiclesAtChargers;
 	for (const auto& vecChargerIntervals : _vecConstrChargerCapacity)
-        vecVehiclesAtChargers.emplace_back(vecChargerIntervals.size(), 0.0);
+        vecVehiclesAtChargers.emplace_back(vecChargerIntervals.size() + 1, 0.0);
 
 	// Step 2: Iterate over the current solution to sum how many vehicles are currently present at each charger at each time:
 	for (auto &vecVehicleSchedules : _vecVarVehicleSchedules)
@@ -1005,15 +1313,17 @@ bool eva::MasterProblem::check_and_update_charger_capacity(const bool add_rmp_ro
 			{
 				for (const ChargingSchedule &chargingSchedule : varSchedule.get_ptr()->vecChargingSchedule)
 				{
-					for (Types::Index indexCharging = chargingSchedule.indexPutOnCharge; indexCharging <= chargingSchedule.indexTakeOffCharge; ++indexCharging)
-					{
-						vecVehiclesAtChargers[chargingSchedule.indexCharger][indexCharging] += _currentHighsSolution.col_value[varSchedule.get_var()];
-					}
+					vecVehiclesAtChargers[chargingSchedule.indexCharger][chargingSchedule.indexPutOnCharge] += _currentHighsSolution.col_value[varSchedule.get_var()];
+					vecVehiclesAtChargers[chargingSchedule.indexCharger][chargingSchedule.indexTakeOffCharge + 1] -= _currentHighsSolution.col_value[varSchedule.get_var()];
 				}
 			}
 		}
 	}
 
+	// The prefix sum gives the number of vehicles in each slot:
+	for (auto& vecVehiclesAtCharger : vecVehiclesAtChargers)
+		std::partial_sum(vecVehiclesAtCharger.begin(), vecVehiclesAtCharger.end(), vecVehiclesAtCharger.begin());
+
 	// Step 3: Check in which time-intervals, the capacity limit was exceeded:
 	std::vector<std::vector<Types::Index>> vecRelIndexesChargerLimitExceeded(_vecConstrChargerCapacity.size());
 	Types::Index indexChargingInterval = 0, indexStartExceeded = Constants::BIG_INDEX, indexEndExceeded = Constants::BIG_INDEX;
@@ -1051,39 +1361,16 @@ bool eva::MasterProblem::check_and_update_charger_capacity(const bool add_rmp_ro
 	// Only necessary if changes are required to be made: 
 	if (add_rmp_rows && !capacities_feasible)
 	{
+#ifdef DEBUG_BUILD
 		for (Types::Index indexCharger = 0; indexCharger < vecRelIndexesChargerLimitExceeded.size(); ++indexCharger)
 		{
-#ifdef DEBUG_BUILD
 			if(vecRelIndexesChargerLimitExceeded[indexCharger].size() > 0)
 				std::cout << "Charger " << indexCharger << ": added " <<  vecRelIndexesChargerLimitExceeded[indexCharger].size() << "." << std::endl;
-#endif // DEBUG_BUILD
-			for (const auto &indexChargingInterval : vecRelIndexesChargerLimitExceeded[indexCharger])
-			{
-				_vecConstrChargerCapacity[indexCharger][indexChargingInterval].set_constr(
-					_addRow(_vecConstrChargerCapacity[indexCharger][indexChargingInterval].get_lb(), _vecConstrChargerCapacity[indexCharger][indexChargingInterval].get_ub()));
-			}
-		}
-
-		// Step 5: Update all column coefficients:
-		// a. Update the current columns:
-		for (auto &vecVehicleSchedules : _vecVarVehicleSchedules)
-		{
-			for (auto &varSchedule : vecVehicleSchedules)
-			{
-				for (const ChargingSchedule &chargingSchedule : varSchedule.get_ptr()->vecChargingSchedule)
-				{
-					for (Types::Index indexCharging = chargingSchedule.indexPutOnCharge; indexCharging <= chargingSchedule.indexTakeOffCharge; indexCharging++)
-					{
-						if (_getConstrChargerCapacity(chargingSchedule.indexCharger, indexCharging).is_in_RMP())
-						{
-							_model.changeCoeff(_getConstrChargerCapacity(chargingSchedule.indexCharger, indexCharging).get_constr(), varSchedule.get_var(), 1.0);
-						}
-					}
-				}
-			}
 		}
+#endif // DEBUG_BUILD
+		_addConstrsChargerCapacity(vecRelIndexesChargerLimitExceeded);
 
-		// Step 6: Update the current status to undefined:
+		// Step 5: Update the current status to undefined:
 		_currentSolutionStatus = MasterProblemSolutionStatus::MP_UNDEFINED;	
 	}
 
@@ -1398,6 +1685,31 @@ HighsInt eva::MasterProblem::_addColumn(const double& cost, const double& lb, co
 	return indexCol;
 }
 
+HighsInt eva::MasterProblem::_addColumns(const ColumnBuffer& columnBuffer)
+{
+	HighsInt indexFirstCol = _model.getNumCol();
+	if (columnBuffer.get_number_columns() == 0)
+		return indexFirstCol;
+
+	HighsStatus colStatus = _model.addCols(
+		columnBuffer.get_number_columns(),
+		columnBuffer.vecCost.data(),
+		columnBuffer.vecLb.data(),
+		columnBuffer.vecUb.data(),
+		static_cast<HighsInt>(columnBuffer.vecIndices.size()),
+		columnBuffer.vecStarts.data(),
+		columnBuffer.vecIndices.data(),
+		columnBuffer.vecValues.data()
+	);
+
+	if (colStatus != HighsStatus::kOk)
+	{
+		throw LogicError("eva::MasterProblem::_addColumns", "Error when trying to add columns to highs model.");
+	}
+
+	return indexFirstCol;
+}
+
 HighsInt eva::MasterProblem::_addRow(const double& lb, const double& ub, const HighsInt& number_nz_coeff, const HighsInt* indices, const double* values)
 {
 	HighsInt indexRow = _model.getNumRow();
@@ -1417,6 +1729,30 @@ HighsInt eva::MasterProblem::_addRow(const double& lb, const double& ub, const H
 	return indexRow;
 }
 
+HighsInt eva::MasterProblem::_addRows(const HighsInt& number_rows, const double* lb, const double* ub, const HighsInt& number_nz_coeff, const HighsInt* starts, const HighsInt* indices, const double* values)
+{
+	HighsInt indexFirstRow = _model.getNumRow();
+	if (number_rows == 0)
+		return indexFirstRow;
+
+	HighsStatus rowStatus = _model.addRows(
+		number_rows,
+		lb,
+		ub,
+		number_nz_coeff,
+		starts,
+		indices,
+		values
+	);
+
+	if (rowStatus != HighsStatus::kOk)
+	{
+		throw LogicError("eva::MasterProblem::_addRows","Error when trying to add rows to highs model.");
+	}
+
+	return indexFirstRow;
+}
+
 HighsInt eva::MasterProblem::_addRow(const double& lb, const double& ub)
 {
 	return _addRow(lb, ub, 0, nullptr, nullptr);
@@ -1438,6 +1774,8 @@ void eva::MasterProblem::_addVars()
 
 	// Initialise the vector with variables for schedules:
 	_vecVarVehicleSchedules.resize(_optinput.get_vehicles().get_vec().size());
+	_vecTripScheduleColumns.resize(_optinput.get_vecTrips().size());
+	_vecMaintenanceScheduleColumns.resize(_optinput.get_vecMaintenances().size());
 }
 
 void eva::MasterProblem::_addConstrs()
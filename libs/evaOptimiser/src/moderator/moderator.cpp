@@ -1,6 +1,55 @@
 #include "incl/moderator/moderator.h"
 #include "evaExceptions.h"
 
+const eva::BranchKey eva::get_branchKey(const Branch& branch)
+{
+	BranchKey key;
+	key.value = branch.get_branchValueBool();
+
+	switch (branch.get_type())
+	{
+	case BranchType::TRIP_UNASSIGNED:
+		// Only a trip that is fixed to be unassigned restricts the schedules:
+		if (key.value)
+		{
+			key.type = BranchType::TRIP_UNASSIGNED;
+			key.indexElement = branch.castBranchTripUnassigned()->get_subTripNodeData().get_index();
+		}
+		break;
+
+	case BranchType::VEHICLE_TRIP:
+		key.type = BranchType::VEHICLE_TRIP;
+		key.indexElement = branch.castBranchVehicleTrip()->get_subTripNodeData().get_index();
+		key.indexVehicle = branch.castBranchVehicleTrip()->get_vehicle().get_index();
+		break;
+
+	case BranchType::VEHICLE_MAINTENANCE:
+		key.type = BranchType::VEHICLE_MAINTENANCE;
+		key.indexElement = branch.castBranchVehicleMaintenance()->get_subMaintenanceNodeData().get_index();
+		key.indexVehicle = branch.castBranchVehicleMaintenance()->get_vehicle().get_index();
+		break;
+
+	case BranchType::VEHICLE_CHARGING_AFTER:
+		key.type = BranchType::VEHICLE_CHARGING_AFTER;
+		key.indexElement = branch.castBranchVehicleChargingAfter()->get_indexFromScheduleNode();
+		key.indexVehicle = branch.castBranchVehicleChargingAfter()->get_vehicle().get_index();
+		key.indexCharger = branch.castBranchVehicleChargingAfter()->get_charger().get_index();
+		break;
+
+	case BranchType::VEHICLE_CHARGING_BEFORE:
+		key.type = BranchType::VEHICLE_CHARGING_BEFORE;
+		key.indexElement = branch.castBranchVehicleChargingBefore()->get_indexToScheduleNode();
+		key.indexVehicle = branch.castBranchVehicleChargingBefore()->get_vehicle().get_index();
+		key.indexCharger = branch.castBranchVehicleChargingBefore()->get_charger().get_index();
+		break;
+
+	default:
+		break;
+	}
+
+	return key;
+}
+
 void eva::BranchNode::_initialise_root(const OptimisationInput& optinput)
 {
 	// Initialsie the map with vehicle fixings:
@@ -33,6 +82,36 @@ void eva::BranchNode::_initialise_child(const Branch &newBranch, const Optimisat
 	_prepare_fixings(optinput);
 }
 
+void eva::BranchNode::_initialise_open(const OpenBranchNode& openBranchNode, const OptimisationInput& optinput)
+{
+	// Collect the branches on the path, from the node up to the root of the search:
+	std::vector<const Branch*> vecPathBranches;
+	for (const BranchPath* ptrPath = openBranchNode.ptrPath.get(); ptrPath != nullptr; ptrPath = ptrPath->ptrParent.get())
+		vecPathBranches.push_back(&ptrPath->branch);
+
+	// Add them in the order they were branched on, and prepare the fixings only once:
+	_vecBranches.reserve(_vecBranches.size() + vecPathBranches.size());
+	for (auto it = vecPathBranches.rbegin(); it != vecPathBranches.rend(); ++it)
+	{
+		_vecBranches.push_back(**it);
+		_update_vehicleFixings(**it);
+	}
+	_prepare_fixings(optinput);
+
+	if (openBranchNode.ptrSortedBranchOptions)
+		_vecSortedBranchOptions = *openBranchNode.ptrSortedBranchOptions;
+}
+
+eva::OpenBranchNode eva::BranchNode::get_openBranchNode(const std::shared_ptr<const BranchPath>& ptrPath) const
+{
+	OpenBranchNode openBranchNode;
+	openBranchNode.index = _index;
+	openBranchNode.lb = _lb;
+	openBranchNode.ptrPath = ptrPath;
+	openBranchNode.ptrSortedBranchOptions = std::make_shared<const std::vector<Branch>>(_vecSortedBranchOptions);
+	return openBranchNode;
+}
+
 void eva::BranchEvaluator::_initialise(const OptimisationInput& optinput)
 {
 	// Initialise the branch evaluators:
@@ -60,6 +139,17 @@ void eva::BranchEvaluator::_update_moving_average(std::pair<double, uint32_t> &c
 	cur.second += 1;
 	cur.first = ((cur.second - 1) * cur.first + new_data_point)/ cur.second;
 }
+void eva::BranchEvaluator::_merge_moving_average(std::pair<double, uint32_t> &cur, const std::pair<double, uint32_t> &other, const std::pair<double, uint32_t> &base)
+{
+	// Only the data points other recorded on top of base are new:
+	if (other.second <= base.second)
+		return;
+
+	const uint32_t nr_new_data_points = other.second - base.second;
+	const double sum_new_data_points = other.second * other.first - base.second * base.first;
+	cur.first = (cur.second * cur.first + sum_new_data_points) / (cur.second + nr_new_data_points);
+	cur.second += nr_new_data_points;
+}
 void eva::BranchEvaluator::update_branch_mean_score(const Branch &branch)
 {
 	switch(branch.get_type())
@@ -116,6 +206,46 @@ void eva::BranchEvaluator::update_branch_mean_score(const Branch &branch)
 		break;
 	};
 }
+void eva::BranchEvaluator::merge(const BranchEvaluator &other, const BranchEvaluator &base)
+{
+	const std::pair<double, uint32_t> no_data_points = std::make_pair(0.0, 0);
+
+	_merge_moving_average(_eval_branch_total_number_vehicles, other._eval_branch_total_number_vehicles, base._eval_branch_total_number_vehicles);
+	_merge_moving_average(_eval_branch_total_number_unassigned_trips, other._eval_branch_total_number_unassigned_trips, base._eval_branch_total_number_unassigned_trips);
+
+	for (size_t i = 0; i < _vec_eval_branch_vehicle_rotation.size(); ++i)
+		_merge_moving_average(_vec_eval_branch_vehicle_rotation[i], other._vec_eval_branch_vehicle_rotation[i], base._vec_eval_branch_vehicle_rotation[i]);
+
+	for (size_t i = 0; i < _vec_eval_branch_trip_unassigned.size(); ++i)
+		_merge_moving_average(_vec_eval_branch_trip_unassigned[i], other._vec_eval_branch_trip_unassigned[i], base._vec_eval_branch_trip_unassigned[i]);
+
+	for (size_t i = 0; i < _vec_eval_branch_vehicle_trip.size(); ++i)
+	{
+		for (size_t j = 0; j < _vec_eval_branch_vehicle_trip[i].size(); ++j)
+			_merge_moving_average(_vec_eval_branch_vehicle_trip[i][j], other._vec_eval_branch_vehicle_trip[i][j], base._vec_eval_branch_vehicle_trip[i][j]);
+	}
+
+	for (size_t i = 0; i < _vec_eval_branch_vehicle_maintenance.size(); ++i)
+	{
+		for (size_t j = 0; j < _vec_eval_branch_vehicle_maintenance[i].size(); ++j)
+			_merge_moving_average(_vec_eval_branch_vehicle_maintenance[i][j], other._vec_eval_branch_vehicle_maintenance[i][j], base._vec_eval_branch_vehicle_maintenance[i][j]);
+	}
+
+	// The charging branches are only stored once evaluated, so base may not know them yet:
+	for (const auto& entry : other._umap_eval_branch_vehicle_charging_after)
+	{
+		auto iterBase = base._umap_eval_branch_vehicle_charging_after.find(entry.first);
+		_merge_moving_average(_umap_eval_branch_vehicle_charging_after[entry.first], entry.second,
+			iterBase != base._umap_eval_branch_vehicle_charging_after.end() ? iterBase->second : no_data_points);
+	}
+
+	for (const auto& entry : other._umap_eval_branch_vehicle_charging_before)
+	{
+		auto iterBase = base._umap_eval_branch_vehicle_charging_before.find(entry.first);
+		_merge_moving_average(_umap_eval_branch_vehicle_charging_before[entry.first], entry.second,
+			iterBase != base._umap_eval_branch_vehicle_charging_before.end() ? iterBase->second : no_data_points);
+	}
+}
 const double eva::BranchEvaluator::get_mean_score(const Branch &branch) const
 {
 	switch(branch.get_type())
@@ -383,15 +513,142 @@ void eva::BranchNode::writeBranchesToConsole()
 
 void eva::Duals::initialise(const OptimisationInput &optinput)
 {
-	// Initialise the specific row sizes of the vecDualsChargerCapacity:
+	// Initialise the specific row sizes of the vecPrefixSumDualsChargerCapacity:
+	// One more entry than capacity constraints, such that every range can be computed as a difference of two entries.
 	for (const Charger& charger : optinput.get_chargers().get_vec())
 	{
-		vecCumSumDualsChargerCapacity[charger.get_index()].resize(optinput.get_vecPutOnChargeNodes(charger.get_index()).size());
-		for (Types::Index indexPutOn = 0; indexPutOn < vecCumSumDualsChargerCapacity[charger.get_index()].size(); ++indexPutOn)
+		vecPrefixSumDualsChargerCapacity[charger.get_index()].assign(optinput.get_vecPutOnChargeNodes(charger.get_index()).size() + 1, 0.0);
+	}
+}
+
+void eva::Duals::set_linearCombination(const double& weightLhs, const Duals& lhs, const double& weightRhs, const Duals& rhs)
+{
+	for (Types::Index idx = 0; idx < vecDualsOneSchedulePerVehicle.size(); ++idx)
+		vecDualsOneSchedulePerVehicle[idx] = weightLhs * lhs.vecDualsOneSchedulePerVehicle[idx] + weightRhs * rhs.vecDualsOneSchedulePerVehicle[idx];
+
+	for (Types::Index idx = 0; idx < vecDualsTripCoverage.size(); ++idx)
+		vecDualsTripCoverage[idx] = weightLhs * lhs.vecDualsTripCoverage[idx] + weightRhs * rhs.vecDualsTripCoverage[idx];
+
+	for (Types::Index idx = 0; idx < vecDualsOneVehiclePerMaintenance.size(); ++idx)
+		vecDualsOneVehiclePerMaintenance[idx] = weightLhs * lhs.vecDualsOneVehiclePerMaintenance[idx] + weightRhs * rhs.vecDualsOneVehiclePerMaintenance[idx];
+
+	// The prefix sums are linear in the duals, hence they can be combined directly:
+	for (Types::Index idxCharger = 0; idxCharger < vecPrefixSumDualsChargerCapacity.size(); ++idxCharger)
+		for (Types::Index idx = 0; idx < vecPrefixSumDualsChargerCapacity[idxCharger].size(); ++idx)
+			vecPrefixSumDualsChargerCapacity[idxCharger][idx] = weightLhs * lhs.vecPrefixSumDualsChargerCapacity[idxCharger][idx] + weightRhs * rhs.vecPrefixSumDualsChargerCapacity[idxCharger][idx];
+
+	dualTotalNumberVehicles = weightLhs * lhs.dualTotalNumberVehicles + weightRhs * rhs.dualTotalNumberVehicles;
+	dualTotalNumberTripsUnassigned = weightLhs * lhs.dualTotalNumberTripsUnassigned + weightRhs * rhs.dualTotalNumberTripsUnassigned;
+}
+
+void eva::HorizonDuals::store(const OptimisationInput& optinput, const Duals& duals)
+{
+	_vecDualsOneSchedulePerVehicle = duals.vecDualsOneSchedulePerVehicle;
+
+	_umapDualsTripCoverage.clear();
+	for (const SubScheduleTripNodeData& trip : optinput.get_vecTrips())
+		_umapDualsTripCoverage[trip.get_scheduleNodeData().get_index()] = duals.vecDualsTripCoverage[trip.get_index()];
+
+	_umapDualsOneVehiclePerMaintenance.clear();
+	for (const SubScheduleMaintenanceNodeData& maintenance : optinput.get_vecMaintenances())
+		_umapDualsOneVehiclePerMaintenance[maintenance.get_scheduleNodeData().get_index()] = duals.vecDualsOneVehiclePerMaintenance[maintenance.get_index()];
+
+	// Recover the dual of each capacity constraint from the prefix sums:
+	_vecUmapDualsChargerCapacity.assign(duals.vecPrefixSumDualsChargerCapacity.size(), std::unordered_map<Types::Index, double>());
+	for (Types::Index idxCharger = 0; idxCharger < duals.vecPrefixSumDualsChargerCapacity.size(); ++idxCharger)
+	{
+		for (const SubSchedulePutOnChargeNodeData& putOnCharge : optinput.get_vecPutOnChargeNodes(idxCharger))
 		{
-			vecCumSumDualsChargerCapacity[charger.get_index()][indexPutOn] = std::vector<double>(vecCumSumDualsChargerCapacity[charger.get_index()].size(), Constants::BIG_DOUBLE);
+			_vecUmapDualsChargerCapacity[idxCharger][putOnCharge.get_scheduleNodeData().get_index()] =
+				duals.get_sumDualsChargerCapacity(idxCharger, putOnCharge.get_index(), putOnCharge.get_index());
 		}
 	}
+
+	_dualTotalNumberVehicles = duals.dualTotalNumberVehicles;
+	_dualTotalNumberTripsUnassigned = duals.dualTotalNumberTripsUnassigned;
+	_isSet = true;
+}
+
+void eva::HorizonDuals::seed(const OptimisationInput& optinput, Duals& duals) const
+{
+	duals.initialise(optinput);
+
+	for (Types::Index idx = 0; idx < duals.vecDualsOneSchedulePerVehicle.size() && idx < _vecDualsOneSchedulePerVehicle.size(); ++idx)
+		duals.vecDualsOneSchedulePerVehicle[idx] = _vecDualsOneSchedulePerVehicle[idx];
+
+	for (const SubScheduleTripNodeData& trip : optinput.get_vecTrips())
+	{
+		auto itDual = _umapDualsTripCoverage.find(trip.get_scheduleNodeData().get_index());
+		duals.vecDualsTripCoverage[trip.get_index()] = itDual != _umapDualsTripCoverage.end() ? itDual->second : optinput.get_config().get_cost_uncovered_trip();
+	}
+
+	for (const SubScheduleMaintenanceNodeData& maintenance : optinput.get_vecMaintenances())
+	{
+		auto itDual = _umapDualsOneVehiclePerMaintenance.find(maintenance.get_scheduleNodeData().get_index());
+		duals.vecDualsOneVehiclePerMaintenance[maintenance.get_index()] = itDual != _umapDualsOneVehiclePerMaintenance.end() ? itDual->second : 0.0;
+	}
+
+	// Rebuild the prefix sums over the capacity constraints of the current planning horizon:
+	for (Types::Index idxCharger = 0; idxCharger < duals.vecPrefixSumDualsChargerCapacity.size() && idxCharger < _vecUmapDualsChargerCapacity.size(); ++idxCharger)
+	{
+		double cumSum = 0.0;
+		for (const SubSchedulePutOnChargeNodeData& putOnCharge : optinput.get_vecPutOnChargeNodes(idxCharger))
+		{
+			auto itDual = _vecUmapDualsChargerCapacity[idxCharger].find(putOnCharge.get_scheduleNodeData().get_index());
+			if (itDual != _vecUmapDualsChargerCapacity[idxCharger].end())
+				cumSum += itDual->second;
+			duals.vecPrefixSumDualsChargerCapacity[idxCharger][putOnCharge.get_index() + 1] = cumSum;
+		}
+	}
+
+	duals.dualTotalNumberVehicles = _dualTotalNumberVehicles;
+	duals.dualTotalNumberTripsUnassigned = _dualTotalNumberTripsUnassigned;
+}
+
+const double eva::DualStabilisation::get_misPricingAlpha(const uint32_t& misPricings) const
+{
+	// Without a stability center, there is nothing to smooth towards:
+	if (!_hasCenter)
+		return 0.0;
+
+	// Wentges mis-pricing sequence: every mis-pricing moves the separation point closer to the current duals,
+	// until the pricing problem is solved with the current duals (alpha = 0):
+	return std::max(0.0, 1.0 - (misPricings + 1) * (1.0 - _alpha));
+}
+
+const eva::Duals& eva::DualStabilisation::update_separationDuals(const Duals& duals, const double& alpha)
+{
+	_separation.set_linearCombination(alpha, _center, 1.0 - alpha, duals);
+	return _separation;
+}
+
+const eva::Duals& eva::DualStabilisation::update_direction(const Duals& duals)
+{
+	// Direction from the stability center towards the current duals:
+	_direction.set_linearCombination(1.0, duals, -1.0, _center);
+	return _direction;
+}
+
+void eva::DualStabilisation::update_center(const Duals& duals, const double& lb)
+{
+	// Only move the stability center if the lagrangian bound has not decreased.
+	// If no bound is known yet, the latest duals are taken as the center:
+	if (!_hasCenter || Helper::compare_floats_smaller_equal(_lbCenter, lb))
+	{
+		_center.set_linearCombination(1.0, duals, 0.0, duals);
+		_lbCenter = lb;
+		_hasCenter = true;
+	}
+}
+
+void eva::DualStabilisation::update_alpha(const double& subgradientProduct)
+{
+	// Automatic smoothing parameter: 
+	// If the subgradient at the separation point points towards the current duals, the smoothing was too strong. Otherwise, it was too weak.
+	if (Helper::compare_floats_smaller(0.0, subgradientProduct))
+		_alpha = std::max(0.0, _alpha - STEP_ALPHA);
+	else
+		_alpha = std::min(MAX_ALPHA, _alpha + (1.0 - _alpha) * STEP_ALPHA);
 }
 
 const bool eva::SubVehicleSchedule::hasChargingAfter(const Types::Index &indexCharger, const Types::Index &indexFromScheduleNode) const
@@ -422,6 +679,64 @@ const bool eva::SubVehicleSchedule::hasChargingBefore(const Types::Index &indexC
 	return false;
 }
 
+void eva::SubVehicleSchedule::update_signature()
+{
+	const uint64_t NR_BITS = 64;
+
+	signatureHash = 0;
+	signatureActivityMask = 0;
+	signatureChargerMask = 0;
+
+	boost::hash_combine(signatureHash, indexVehicle);
+
+	// Trips and maintenances share the activity mask, with the maintenances starting at the opposite end:
+	for (const Types::Index& idxTrip : vecTripNodeIndexes)
+	{
+		boost::hash_combine(signatureHash, idxTrip);
+		signatureActivityMask |= uint64_t(1) << (idxTrip % NR_BITS);
+	}
+
+	boost::hash_combine(signatureHash, vecMaintenanceNodesIndexes.size());
+	for (const Types::Index& idxMaintenance : vecMaintenanceNodesIndexes)
+	{
+		boost::hash_combine(signatureHash, idxMaintenance);
+		signatureActivityMask |= uint64_t(1) << (NR_BITS - 1 - idxMaintenance % NR_BITS);
+	}
+
+	boost::hash_combine(signatureHash, vecChargingSchedule.size());
+	for (const ChargingSchedule& cs : vecChargingSchedule)
+	{
+		boost::hash_combine(signatureHash, cs.indexCharger);
+		boost::hash_combine(signatureHash, cs.indexPutOnCharge);
+		boost::hash_combine(signatureHash, cs.indexTakeOffCharge);
+		signatureChargerMask |= uint64_t(1) << (cs.indexCharger % NR_BITS);
+	}
+}
+
+const bool eva::SubVehicleSchedule::isIdenticalTo(const SubVehicleSchedule &other) const
+{
+	if (signatureHash != other.signatureHash
+		|| indexVehicle != other.indexVehicle
+		|| vecTripNodeIndexes != other.vecTripNodeIndexes
+		|| vecMaintenanceNodesIndexes != other.vecMaintenanceNodesIndexes
+		|| vecChargingSchedule.size() != other.vecChargingSchedule.size())
+		return false;
+
+	for (size_t posCharging = 0; posCharging < vecChargingSchedule.size(); ++posCharging)
+	{
+		const ChargingSchedule& cs = vecChargingSchedule[posCharging];
+		const ChargingSchedule& otherCs = other.vecChargingSchedule[posCharging];
+		if (cs.indexCharger != otherCs.indexCharger
+			|| cs.indexPutOnCharge != otherCs.indexPutOnCharge
+			|| cs.indexTakeOffCharge != otherCs.indexTakeOffCharge
+			|| cs.indexFromScheduleNode != otherCs.indexFromScheduleNode
+			|| cs.indexToScheduleNode != otherCs.indexToScheduleNode)
+			return false;
+	}
+
+	return true;
+}
+
 const bool eva::SubVehicleSchedule::isSubsetOf(const SubVehicleSchedule &other) const
 {
     // 1. Check if generally all sets are smaller or equal.
@@ -652,7 +967,7 @@ const double eva::SubVehicleSchedule::get_current_reducedCost(const Duals &duals
 
 	// 4. Constraint: Charger Usage:
 	for(const auto& cs : vecChargingSchedule)
-		sumDualValues += duals.vecCumSumDualsChargerCapacity[cs.indexCharger][cs.indexPutOnCharge][cs.indexTakeOffCharge];
+		sumDualValues += duals.get_sumDualsChargerCapacity(cs.indexCharger, cs.indexPutOnCharge, cs.indexTakeOffCharge);
 
 	// Return the reduced cost rc = cost - duals:
     return cost - sumDualValues;
@@ -1,7 +1,7 @@
 #include "incl/pricingProblem/pricingProblem.h"
+#include <algorithm>
 #include <chrono>
 #include <omp.h>
-#include <random>
 
 void eva::PricingProblem::_initialise()
 {
@@ -52,8 +52,8 @@ eva::PricingProblemResult eva::PricingProblem::_tsn_find_neg_reduced_cost_schedu
 			vecVehicleRotationBool[branch.castBranchVehicleRotation()->get_vehicle().get_index()] = branch.get_branchValueBool();
 	}
 
-	// Create a randomly shuffled vector of all vehicle indexes in the rotation:
-	std::vector<Types::Index> vecShuffledVehicleRotation = _shuffleVecVehicleRotation(vecVehicleRotationBool);
+	// Order all vehicle indexes in the rotation, either randomly or by their score:
+	std::vector<Types::Index> vecShuffledVehicleRotation = _vehicleSelector.get_orderedVehicles(vecVehicleRotationBool, duals, _get_batchSize());
 	
 	// Determine if the pricing problem must be solved to optimality or a shortened version can be solved:
 	if (solve_all_vehicles)
@@ -65,10 +65,7 @@ eva::PricingProblemResult eva::PricingProblem::_tsn_find_neg_reduced_cost_schedu
 	{
 		// Iterate over the vehicles in batches, and only continue if no optimal solution has been found:
 		// Split the shuffled vehicles in two:
-		uint32_t totalSelect = std::min(_optinput.get_config().get_const_nr_threads(), static_cast<uint32_t>(vecShuffledVehicleRotation.size()));
-		#ifdef DEBUG_BUILD
-			totalSelect = std::min(static_cast<uint32_t>(2), static_cast<uint32_t>(vecShuffledVehicleRotation.size()));
-		#endif // DEBUG_BUILD	
+		const uint32_t totalSelect = std::min(_get_batchSize(), static_cast<uint32_t>(vecShuffledVehicleRotation.size()));
 
 		std::vector<Types::Index> vecVehicleRotationRandomInclude(vecShuffledVehicleRotation.begin(), vecShuffledVehicleRotation.begin() + totalSelect);
 		std::vector<Types::Index> vecVehicleRotationRandomExclude(vecShuffledVehicleRotation.begin() + totalSelect, vecShuffledVehicleRotation.end());
@@ -147,8 +144,8 @@ eva::PricingProblemResult eva::PricingProblem::_connection_sbn_find_neg_reduced_
 			vecVehicleRotationBool[branch.castBranchVehicleRotation()->get_vehicle().get_index()] = branch.get_branchValueBool();
 	}
 
-	// Create a randomly shuffled vector of all vehicle indexes in the rotation:
-	std::vector<Types::Index> vecShuffledVehicleRotation = _shuffleVecVehicleRotation(vecVehicleRotationBool);
+	// Order all vehicle indexes in the rotation, either randomly or by their score:
+	std::vector<Types::Index> vecShuffledVehicleRotation = _vehicleSelector.get_orderedVehicles(vecVehicleRotationBool, duals, _get_batchSize());
 
 	// b. Create the reduced segment network:
 	std::chrono::high_resolution_clock::time_point startClockConstruction = std::chrono::high_resolution_clock::now();
@@ -167,10 +164,7 @@ eva::PricingProblemResult eva::PricingProblem::_connection_sbn_find_neg_reduced_
 	{
 		// Iterate over the vehicles in batches, and only continue if no optimal solution has been found:
 		// Split the shuffled vehicles in two:
-		uint32_t totalSelect = std::min(_optinput.get_config().get_const_nr_threads(), static_cast<uint32_t>(vecShuffledVehicleRotation.size()));
-		#ifdef DEBUG_BUILD
-			totalSelect = std::min(static_cast<uint32_t>(2), static_cast<uint32_t>(vecShuffledVehicleRotation.size()));
-		#endif // DEBUG_BUILD	
+		const uint32_t totalSelect = std::min(_get_batchSize(), static_cast<uint32_t>(vecShuffledVehicleRotation.size()));
 
 		std::vector<Types::Index> vecVehicleRotationRandomInclude(vecShuffledVehicleRotation.begin(), vecShuffledVehicleRotation.begin() + totalSelect);
 		std::vector<Types::Index> vecVehicleRotationRandomExclude(vecShuffledVehicleRotation.begin() + totalSelect, vecShuffledVehicleRotation.end());
@@ -249,8 +243,8 @@ eva::PricingProblemResult eva::PricingProblem::_centralised_sbn_find_neg_reduced
 			vecVehicleRotationBool[branch.castBranchVehicleRotation()->get_vehicle().get_index()] = branch.get_branchValueBool();
 	}
 
-	// Create a randomly shuffled vector of all vehicle indexes in the rotation:
-	std::vector<Types::Index> vecShuffledVehicleRotation = _shuffleVecVehicleRotation(vecVehicleRotationBool);
+	// Order all vehicle indexes in the rotation, either randomly or by their score:
+	std::vector<Types::Index> vecShuffledVehicleRotation = _vehicleSelector.get_orderedVehicles(vecVehicleRotationBool, duals, _get_batchSize());
 
 	// b. Create the reduced segment network:
 	std::chrono::high_resolution_clock::time_point startClockConstruction = std::chrono::high_resolution_clock::now();
@@ -269,10 +263,7 @@ eva::PricingProblemResult eva::PricingProblem::_centralised_sbn_find_neg_reduced
 	{
 		// Iterate over the vehicles in batches, and only continue if no optimal solution has been found:
 		// Split the shuffled vehicles in two:
-		uint32_t totalSelect = std::min(_optinput.get_config().get_const_nr_threads(), static_cast<uint32_t>(vecShuffledVehicleRotation.size()));
-		#ifdef DEBUG_BUILD
-			totalSelect = std::min(static_cast<uint32_t>(2), static_cast<uint32_t>(vecShuffledVehicleRotation.size()));
-		#endif // DEBUG_BUILD	
+		const uint32_t totalSelect = std::min(_get_batchSize(), static_cast<uint32_t>(vecShuffledVehicleRotation.size()));
 
 		std::vector<Types::Index> vecVehicleRotationRandomInclude(vecShuffledVehicleRotation.begin(), vecShuffledVehicleRotation.begin() + totalSelect);
 		std::vector<Types::Index> vecVehicleRotationRandomExclude(vecShuffledVehicleRotation.begin() + totalSelect, vecShuffledVehicleRotation.end());
@@ -346,7 +337,7 @@ void eva::PricingProblem::_solve_tsn_pricing_problem(const std::vector<Types::In
 #ifdef DEBUG_BUILD
 	omp_set_num_threads(1);
 #else
-	omp_set_num_threads(_optinput.get_config().get_const_nr_threads());
+	omp_set_num_threads(_nr_threads);
 #endif // DEBUG_BUILD	
 #pragma omp parallel for
 	for (int32_t idxIn = 0;
@@ -355,6 +346,8 @@ void eva::PricingProblem::_solve_tsn_pricing_problem(const std::vector<Types::In
 	{
 		result.resSchedule[vecVehicleIndexes[idxIn]] = _tsn.find_neg_reduced_cost_schedule_vehicle(duals, _optinput.get_vehicle(vecVehicleIndexes[idxIn]), brn, include_cost,solve_to_optimal, isSolvedOptimal, timeOutClock);
 	}
+
+	_vehicleSelector.record_pricing(vecVehicleIndexes, result.resSchedule);
 }
 
 void eva::PricingProblem::_solve_connection_sbn_pricing_problem(const std::vector<Types::Index>& vecVehicleIndexes, PricingProblemResult& result, const Duals& duals, const BranchNode& brn, const bool include_cost,const bool solve_to_optimal, bool& isSolvedOptimal, const std::chrono::high_resolution_clock::time_point& timeOutClock)
@@ -362,7 +355,7 @@ void eva::PricingProblem::_solve_connection_sbn_pricing_problem(const std::vecto
 #ifdef DEBUG_BUILD
 	omp_set_num_threads(1);
 #else
-	omp_set_num_threads(_optinput.get_config().get_const_nr_threads());
+	omp_set_num_threads(_nr_threads);
 #endif // DEBUG_BUILD	
 #pragma omp parallel for
 	for (int32_t idxIn = 0;
@@ -371,6 +364,8 @@ void eva::PricingProblem::_solve_connection_sbn_pricing_problem(const std::vecto
 	{
 		result.resSchedule[vecVehicleIndexes[idxIn]] = _connection_sbn.find_neg_reduced_cost_schedule_vehicle(duals, _optinput.get_vehicle(vecVehicleIndexes[idxIn]), brn, include_cost,solve_to_optimal, isSolvedOptimal,timeOutClock);
 	}
+
+	_vehicleSelector.record_pricing(vecVehicleIndexes, result.resSchedule);
 }
 
 void eva::PricingProblem::_solve_centralised_sbn_pricing_problem(const std::vector<Types::Index> &vecVehicleIndexes, PricingProblemResult &result, const Duals &duals, const BranchNode &brn, const bool include_cost, const bool solve_to_optimal, bool &isSolvedOptimal, const std::chrono::high_resolution_clock::time_point& timeOutClock)
@@ -378,7 +373,7 @@ void eva::PricingProblem::_solve_centralised_sbn_pricing_problem(const std::vect
 	#ifdef DEBUG_BUILD
 	omp_set_num_threads(1);
 #else
-	omp_set_num_threads(_optinput.get_config().get_const_nr_threads());
+	omp_set_num_threads(_nr_threads);
 #endif // DEBUG_BUILD	
 #pragma omp parallel for
 	for (int32_t idxIn = 0;
@@ -387,24 +382,24 @@ void eva::PricingProblem::_solve_centralised_sbn_pricing_problem(const std::vect
 	{
 		result.resSchedule[vecVehicleIndexes[idxIn]] = _centralised_sbn.find_neg_reduced_cost_schedule_vehicle(duals, _optinput.get_vehicle(vecVehicleIndexes[idxIn]), brn, include_cost,solve_to_optimal, isSolvedOptimal,timeOutClock);
 	}
+
+	_vehicleSelector.record_pricing(vecVehicleIndexes, result.resSchedule);
 }
 
-std::vector<eva::Types::Index> eva::PricingProblem::_shuffleVecVehicleRotation(const std::vector<uint8_t>& vecVehicleRotation)
+void eva::PricingProblem::set_nr_threads(const uint32_t nr_threads)
 {
-	// a. Create a vector with all vehicles in rotation:
-	std::vector<Types::Index> vecResult;
-	for (Types::Index idx = 0; idx < vecVehicleRotation.size(); ++idx)
-	{
-		if (vecVehicleRotation[idx] == 1)
-			vecResult.push_back(idx);
-	}
-
-	// b. Shuffle the vector of indices:
-	std::random_device rd;
-	std::mt19937 g(rd());
-	std::shuffle(vecResult.begin(), vecResult.end(), g);
+	_nr_threads = std::max(static_cast<uint32_t>(1), nr_threads);
+	_connection_sbn.set_nr_threads(_nr_threads);
+	_centralised_sbn.set_nr_threads(_nr_threads);
+}
 
-	return vecResult;
+const uint32_t eva::PricingProblem::_get_batchSize() const
+{
+#ifdef DEBUG_BUILD
+	return 2;
+#else
+	return _optinput.get_config().get_const_nr_threads();
+#endif // DEBUG_BUILD
 }
 
 eva::PricingProblemResult eva::PricingProblem::find_neg_reduced_cost_schedule(const Duals& duals, const BranchNode& brn, const bool include_cost,const bool solve_to_optimal, const bool solve_all_vehicles, const std::chrono::high_resolution_clock::time_point& timeOutClock)
@@ -461,3 +456,17 @@ const uint32_t eva::PricingProblem::get_number_segments() const
 
 	return 0;
 }
+
+const uint32_t eva::PricingProblem::get_number_skipped_segments() const
+{
+	if (_optinput.get_config().get_const_pricing_problem_type() == Types::PricingProblemType::CONNECTION_SEGMENT_NETWORK)
+	{
+		return _connection_sbn.get_number_skipped_segments();
+	}
+	else if(_optinput.get_config().get_const_pricing_problem_type() == Types::PricingProblemType::CENTRALISED_SEGMENT_NETWORK)
+	{
+		return _centralised_sbn.get_number_skipped_segments();
+	};
+
+	return 0;
+}
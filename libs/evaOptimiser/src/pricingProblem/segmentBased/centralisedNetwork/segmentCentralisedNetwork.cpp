@@ -158,7 +158,7 @@ bool eva::sbn::cen::CentralisedBasedResourceExtensionFunction::operator()(const
 			// If charging takes place, increase the soc:
 			if (session.is_charging)
 			{
-				new_cont.reducedCost -= _duals.vecCumSumDualsChargerCapacity[targetNodeData.get_startChargerIndex()][session.index_putOnCharge][session.index_takeOffCharge];
+				new_cont.reducedCost -= _duals.get_sumDualsChargerCapacity(targetNodeData.get_startChargerIndex(), session.index_putOnCharge, session.index_takeOffCharge);
 			}
 		}
 		else
@@ -275,7 +275,7 @@ void eva::sbn::cen::CentralisedBasedSegmentNetwork::_addNodes(const BranchNode &
 #ifdef DEBUG_BUILD
 	omp_set_num_threads(1);
 #else
-	omp_set_num_threads(_optinput.get_config().get_const_nr_threads());
+	omp_set_num_threads(_nr_threads);
 #endif // DEBUG_BUILD
 #pragma omp parallel for
 	for (int32_t indexSegment = 0;
@@ -306,7 +306,7 @@ void eva::sbn::cen::CentralisedBasedSegmentNetwork::_addNodes(const BranchNode &
 					segment,
 					nonDomPiece),
 				_optinput.get_vehicles().get_vec().size());
-			tmpNodeData.init_access(nonDomPiece.get_vecVehicleAccess()); // This does not yet fix the segment node. Only sets access.
+			tmpNodeData.init_access(nonDomPiece.get_vehicleAccess()); // This does not yet fix the segment node. Only sets access.
 			tmpNode = _addNode(tmpNodeData);
 			vecSegmentFragmentNodes.push_back(tmpNode);
 
@@ -527,7 +527,7 @@ eva::sbn::cen::BoostCentralisedBasedArc eva::sbn::cen::CentralisedBasedSegmentNe
 
 void eva::sbn::cen::CentralisedBasedSegmentNetwork::initialise()
 {
-	_segments.initialise(_optinput);
+	_segments.initialise(_optinput, _nr_threads);
 }
 
 void eva::sbn::cen::CentralisedBasedSegmentNetwork::create_reduced_graph(const Duals &duals, const BranchNode &brn)
@@ -665,7 +665,7 @@ void eva::sbn::cen::CentralisedBasedSegmentNetwork::update_branch_node_fixings(c
 #ifdef DEBUG_BUILD
 	omp_set_num_threads(1);
 #else
-	omp_set_num_threads(_optinput.get_config().get_const_nr_threads());
+	omp_set_num_threads(_nr_threads);
 #endif // DEBUG_BUILD
 #pragma omp parallel for
 	for (int32_t indexSegment = 0;
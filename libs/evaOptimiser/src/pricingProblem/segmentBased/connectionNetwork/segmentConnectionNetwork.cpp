@@ -12,15 +12,36 @@ void eva::sbn::con::ConnectionBasedSegmentNetwork::_clearNetwork()
 
 	// 2. Clean local vectors:
 	_vecVehicleStartNodes.erase(_vecVehicleStartNodes.begin(), _vecVehicleStartNodes.end());
-	_vecSortedNodesChargerToCharger.erase(_vecSortedNodesChargerToCharger.begin(), _vecSortedNodesChargerToCharger.end());
 	_vecIncludesTripNodes.erase(_vecIncludesTripNodes.begin(), _vecIncludesTripNodes.end());
 	_vecIncludesMaintenanceNodes.erase(_vecIncludesMaintenanceNodes.begin(), _vecIncludesMaintenanceNodes.end());
 	_mapIncludesScheduleNode.clear();
+	_vecSortedSegmentNodes.assign(_segments.get_vec().size(), std::vector<BoostConnectionBasedNode>());
 	_endNode = 0;
 
 	// 3. Reset the index:
 	_indexNode = 0;
 	_indexArc = 0;
+	_nrRetiredNodes = 0;
+}
+
+void eva::sbn::con::ConnectionBasedSegmentNetwork::_updateSegments(const BranchNode& brn, const Duals& duals)
+{
+	// Solve the subgraphs, and keep track of the segments for which the non dominated schedule pieces have changed:
+	_vecSegmentChanged.assign(_segments.get_vec().size(), 0);
+
+	// The OpenMP framework apparently only supports integer types in the for loop, not unsigned integers.
+	#ifdef DEBUG_BUILD
+	omp_set_num_threads(1);
+#else
+	omp_set_num_threads(_nr_threads);
+#endif // DEBUG_BUILD			
+#pragma omp parallel for
+	for (int32_t indexSegment = 0;
+		indexSegment < _segments.get_vec().size();
+		indexSegment++)
+	{
+		_vecSegmentChanged[indexSegment] = _segments.get_vec()[indexSegment].updateNonDominatedSchedulePieces(brn, duals);
+	}
 }
 
 void eva::sbn::con::ConnectionBasedSegmentNetwork::_addNodes(const BranchNode& brn, const Duals& duals)
@@ -68,83 +89,158 @@ void eva::sbn::con::ConnectionBasedSegmentNetwork::_addNodes(const BranchNode& b
 		_vecVehicleStartNodes[vehicle.get_index()] = _addNode(tmpNodeData);
 	}
 
-	// 3. Find all currently non-dominated paths:
-	// Step A: Solve the subgraphs:
-	// The OpenMP framework apparently only supports integer types in the for loop, not unsigned integers.
-	#ifdef DEBUG_BUILD
-	omp_set_num_threads(1);
-#else
-	omp_set_num_threads(_optinput.get_config().get_const_nr_threads());
-#endif // DEBUG_BUILD			
-#pragma omp parallel for
-	for (int32_t indexSegment = 0;
-		indexSegment < _segments.get_vec().size();
-		indexSegment++)
+	// 3. Add the currently non dominated schedule pieces of all segments:
+	// The subgraphs must be solved beforehand.
+	for (Types::Index indexSegment = 0; indexSegment < _segments.get_vec().size(); ++indexSegment)
+		_addSegmentNodes(indexSegment);
+
+	_updateLookUps();
+}
+
+void eva::sbn::con::ConnectionBasedSegmentNetwork::_addSegmentNodes(const Types::Index& indexSegment)
+{
+	const Segment& segment = _segments.get_vec()[indexSegment];
+	std::vector<BoostConnectionBasedNode>& vecSegmentFragmentNodes = _vecSortedSegmentNodes[indexSegment];
+	std::vector<eva::sbn::con::BoostConnectionBasedNode>::iterator iterPosition;
+	ConNodeData tmpNodeData;
+
+	// Iterate the non dominated schedule fragments:
+	for (const auto& nonDomPiece : segment.get_vecNonDominatedSchedulePieces())
 	{
-		_segments.get_vec()[indexSegment].updateNonDominatedSchedulePieces(brn, duals);
+		// Find position in time-sorted vector, and store the node:
+		iterPosition = std::lower_bound(
+			vecSegmentFragmentNodes.begin(),
+			vecSegmentFragmentNodes.end(),
+			nonDomPiece.get_endTime(),
+			[&](const BoostConnectionBasedNode& l, Types::DateTime value)
+			{
+				return _getNodeData(l).get_endTime() < value;
+			});
+
+		// Store the new node in the sorted location:
+		tmpNodeData = ConNodeData(
+			SegmentPieceNodeData(
+				segment,
+				nonDomPiece
+			),
+			_optinput.get_vehicles().get_vec().size()
+		);
+		tmpNodeData.init_access(nonDomPiece.get_vehicleAccess()); // This does not yet fix the segment node. Only sets access.
+		vecSegmentFragmentNodes.insert(iterPosition, _addNode(tmpNodeData));
 	}
+}
 
-	// Step B: Add the non dominated schedule pieces:
-	_vecSortedNodesChargerToCharger.resize(_optinput.get_chargers().get_vec().size(), std::vector<std::vector<std::vector<BoostConnectionBasedNode>>>(_optinput.get_chargers().get_vec().size()));
-	_vecIncludesTripNodes.resize(_optinput.get_vecTrips().size());
-	_vecIncludesMaintenanceNodes.resize(_optinput.get_vecMaintenances().size());
-	
-	BoostConnectionBasedNode tmpNode;
-	std::vector<eva::sbn::con::BoostConnectionBasedNode>::iterator iterPosition;
-	auto iterMapIncludesScheduleNodes = _mapIncludesScheduleNode.begin();
-	std::vector<BoostConnectionBasedNode> vecSegmentFragmentNodes;
+void eva::sbn::con::ConnectionBasedSegmentNetwork::_retireSegmentNodes(const Types::Index& indexSegment)
+{
+	// The vertices cannot be removed from the boost network without invalidating all other vertex descriptors.
+	// Hence, the nodes are disconnected and turned into undefined nodes, that can never be reached by any label.
+	for (const BoostConnectionBasedNode& node : _vecSortedSegmentNodes[indexSegment])
+	{
+		boost::clear_out_edges(node, _boostSegmentNetwork);
 
-	// Step B cont'd: Iterate all segments, and store the non dominated schedule pieces:
-	for (const Segment& segment : _segments.get_vec())
+		Types::Index index = _getNodeData(node).index;
+		_getNodeData(node) = ConNodeData();
+		_getNodeData(node).index = index;
+		++_nrRetiredNodes;
+	}
+	_vecSortedSegmentNodes[indexSegment].clear();
+}
+
+void eva::sbn::con::ConnectionBasedSegmentNetwork::_updateLookUps()
+{
+	_vecIncludesTripNodes.assign(_optinput.get_vecTrips().size(), std::vector<BoostConnectionBasedNode>());
+	_vecIncludesMaintenanceNodes.assign(_optinput.get_vecMaintenances().size(), std::vector<BoostConnectionBasedNode>());
+	_mapIncludesScheduleNode.clear();
+
+	auto iterMapIncludesScheduleNodes = _mapIncludesScheduleNode.begin();
+	for (const std::vector<BoostConnectionBasedNode>& vecSegmentFragmentNodes : _vecSortedSegmentNodes)
 	{
-		// Iterate the non dominated schedule fragments:
-		for (const auto& nonDomPiece : segment.get_vecNonDominatedSchedulePieces())
+		for (const BoostConnectionBasedNode& node : vecSegmentFragmentNodes)
 		{
-			// Find position in time-sorted vector, and store the node:
-			iterPosition = std::lower_bound(
-				vecSegmentFragmentNodes.begin(),
-				vecSegmentFragmentNodes.end(),
-				nonDomPiece.get_endTime(),
-				[&](const BoostConnectionBasedNode& l, Types::DateTime value)
-				{
-					return _getNodeData(l).get_endTime() < value;
-				});
-
-			// Store the new node in the sorted location:
-			tmpNodeData = ConNodeData(
-				SegmentPieceNodeData(
-					segment,
-					nonDomPiece
-				),
-				_optinput.get_vehicles().get_vec().size()
-			);
-			tmpNodeData.init_access(nonDomPiece.get_vecVehicleAccess()); // This does not yet fix the segment node. Only sets access.
-			tmpNode = _addNode(tmpNodeData);
-			vecSegmentFragmentNodes.insert(iterPosition, tmpNode);
-
-			// Finally update the look-ups:
+			const subgraph::NonDominatedSchedulePiece& nonDomPiece = _getNodeData(node).castSegmentPieceNodeData()->get_nonDominatedSchedulePiece();
+
 			// Store a reference to the node of all trip and maintenance nodes that it includes:
 			for (const Types::Index indexTrip : nonDomPiece.get_vecTripIndexes())
-				_vecIncludesTripNodes[indexTrip].push_back(tmpNode);
+				_vecIncludesTripNodes[indexTrip].push_back(node);
 
 			for (const Types::Index indexMaintenance : nonDomPiece.get_vecMaintenanceIndexes())
-				_vecIncludesMaintenanceNodes[indexMaintenance].push_back(tmpNode);
+				_vecIncludesMaintenanceNodes[indexMaintenance].push_back(node);
 
 			// Store a reference to every schedule node in the segment node:
 			for (const Types::Index scheduleNode : nonDomPiece.get_vecScheduleNodeIndexes())
 			{
 				iterMapIncludesScheduleNodes = _mapIncludesScheduleNode.find(scheduleNode);
 				if (iterMapIncludesScheduleNodes != _mapIncludesScheduleNode.end())
-					iterMapIncludesScheduleNodes->second.push_back(tmpNode);
+					iterMapIncludesScheduleNodes->second.push_back(node);
 				else
-					_mapIncludesScheduleNode.insert(std::make_pair(scheduleNode, std::vector<BoostScheduleNode>({tmpNode})));
+					_mapIncludesScheduleNode.insert(std::make_pair(scheduleNode, std::vector<BoostScheduleNode>({node})));
+			}
+		}
+	}
+}
+
+std::vector<eva::sbn::con::FullConArcData> eva::sbn::con::ConnectionBasedSegmentNetwork::_createOutgoingArcs(const BoostConnectionBasedNode fromNode, const Duals& duals)
+{
+	std::vector<FullConArcData> vecArcsOutgoing;
+
+	// Add all outgoing edges from segment nodes and start nodes:
+	if (_getNodeData(fromNode).type == ConNodeType::SEGMENT || _getNodeData(fromNode).type == ConNodeType::START_SCHEDULE)
+	{
+		for (const Charger &toEndCharger : _optinput.get_chargers().get_vec())
+		{
+			for (const Types::Index &indexSegment : _vecSegmentsChargerToCharger[_getNodeData(fromNode).get_endChargerIndex()][toEndCharger.get_index()])
+			{
+				// Create a new skyline for all edges to the segment node:
+				ConArcSkyline skyline;
+
+				// The segment nodes are sorted by their end time. A node that ends before the fromNode ends, also starts before it.
+				// Hence, the first candidate is found by binary search:
+				const std::vector<BoostConnectionBasedNode> &vecSegmentFragmentNodes = _vecSortedSegmentNodes[indexSegment];
+				auto iterFirstCandidate = std::lower_bound(
+					vecSegmentFragmentNodes.begin(),
+					vecSegmentFragmentNodes.end(),
+					_getNodeData(fromNode).get_endTime(),
+					[&](const BoostConnectionBasedNode &l, Types::DateTime value)
+					{
+						return _getNodeData(l).get_endTime() < value;
+					});
+
+				// Iterate all nodes starting from the same node of the startNode, and finishing at endCharger:
+				for (auto iterToNode = iterFirstCandidate; iterToNode != vecSegmentFragmentNodes.end(); ++iterToNode)
+				{
+					// Function checks if the toNode is dominated
+					if (_isFeasible(fromNode, *iterToNode))
+					{
+						// Create the arcData object:
+						FullConArcData arcData = _createArcData(fromNode, *iterToNode, duals);
+
+						// Check if there is at least one vehicle allowed on the arc:
+						if (arcData.is_feasible())
+							skyline.insert(arcData);
+					}
+				}
+
+				// Store the non-dominated arcs:
+				vecArcsOutgoing.insert(vecArcsOutgoing.end(), skyline.get_vecArcs().begin(), skyline.get_vecArcs().end());
 			}
 		}
+	}
 
-		// Finally store the segment nodes:
-		_vecSortedNodesChargerToCharger[segment.get_startCharger().get_index()][segment.get_endCharger().get_index()].push_back(vecSegmentFragmentNodes);
-		vecSegmentFragmentNodes.clear();
+	// At last, sort the outgoing arcs based on being most promising:
+	// Using an estimate on the reduced cost to determine the order.
+	std::sort(vecArcsOutgoing.begin(), vecArcsOutgoing.end(), [](const FullConArcData &l, const FullConArcData &r)
+			  { return Helper::compare_floats_smaller(
+					l.bestCaseCost - (l.accDuals + l.maxChargingDuals),
+					r.bestCaseCost - (r.accDuals + r.maxChargingDuals)); });
+
+	// Finally, add one edge to the end-node:
+	if (_getNodeData(fromNode).type == ConNodeType::SEGMENT
+		&& _getNodeData(fromNode).is_flag_outgoing_to_sink_allowed())
+	{
+		vecArcsOutgoing.push_back(_createArcData(fromNode, _endNode, duals));
 	}
+
+	return vecArcsOutgoing;
 }
 
 void eva::sbn::con::ConnectionBasedSegmentNetwork::_addArcs(const BranchNode& brn, const Duals& duals)
@@ -157,60 +253,14 @@ void eva::sbn::con::ConnectionBasedSegmentNetwork::_addArcs(const BranchNode& br
 #ifdef DEBUG_BUILD
 	omp_set_num_threads(1);
 #else
-	omp_set_num_threads(_optinput.get_config().get_const_nr_threads());
+	omp_set_num_threads(_nr_threads);
 #endif // DEBUG_BUILD
 #pragma omp parallel for
 	for (int32_t indexFromNode = 0;
 		 indexFromNode < _indexNode;
 		 indexFromNode++)
 	{
-		// Add all outgoing edges from segment nodes and start nodes:
-			if (_getNodeData(indexFromNode).type == ConNodeType::SEGMENT || _getNodeData(indexFromNode).type == ConNodeType::START_SCHEDULE)
-			{
-				for (const Charger &toEndCharger : _optinput.get_chargers().get_vec())
-				{
-					for (const std::vector<BoostConnectionBasedNode> &vecSegmentNodes : _vecSortedNodesChargerToCharger[_getNodeData(indexFromNode).get_endChargerIndex()][toEndCharger.get_index()])
-					{
-						// Create a new vector for all edges to the segment node:
-						std::vector<FullConArcData> vecNonDominatedArcs;
-
-						// Iterate all nodes starting from the same node of the startNode, and finishing at endCharger:
-						for (const auto &toNode : vecSegmentNodes)
-						{
-							// Function checks if the toNode is dominated
-							if (_isFeasible(indexFromNode, toNode))
-							{
-								// Create the arcData object:
-								FullConArcData arcData = _createArcData(indexFromNode, toNode, duals);
-
-								// Check if there is at least one vehicle allowed on the arc:
-								if (arcData.is_feasible())
-								{
-									if (!_isDominated(vecNonDominatedArcs, arcData))
-										vecNonDominatedArcs.push_back(arcData);
-								}
-							}
-						}
-
-						// Store the non-dominated arcs:
-						vecArcsOutgoing[indexFromNode].insert(vecArcsOutgoing[indexFromNode].end(), vecNonDominatedArcs.begin(), vecNonDominatedArcs.end());
-					}
-				}
-			}
-
-			// At last, sort the outgoing arcs based on being most promising:
-			// Using an estimate on the reduced cost to determine the order.
-			std::sort(vecArcsOutgoing[indexFromNode].begin(), vecArcsOutgoing[indexFromNode].end(), [](const FullConArcData &l, const FullConArcData &r)
-					  { return Helper::compare_floats_smaller(
-							l.bestCaseCost - (l.accDuals + l.maxChargingDuals),
-							r.bestCaseCost - (r.accDuals + r.maxChargingDuals)); });
-
-			// Finally, add one edge to the end-node:
-			if (_getNodeData(indexFromNode).type == ConNodeType::SEGMENT
-				&& _getNodeData(indexFromNode).is_flag_outgoing_to_sink_allowed())
-			{
-				vecArcsOutgoing[indexFromNode].push_back(_createArcData(indexFromNode, _endNode, duals));
-			}
+		vecArcsOutgoing[indexFromNode] = _createOutgoingArcs(indexFromNode, duals);
 	}
 
 	// Finally, add all arcs to the boost network:
@@ -223,6 +273,53 @@ void eva::sbn::con::ConnectionBasedSegmentNetwork::_addArcs(const BranchNode& br
 	}
 }
 
+void eva::sbn::con::ConnectionBasedSegmentNetwork::_updateArcs(const BranchNode& brn, const Duals& duals, const Types::Index& indexFirstNewNode)
+{
+	// Only nodes that are new, or that connect to a segment that has changed, require their outgoing arcs to be updated.
+	// Arcs to unchanged segment nodes are identical, because the arc data only depends on the two nodes it connects.
+	std::vector<uint8_t> vecStartChargerChanged(_optinput.get_chargers().get_vec().size(), 0);
+	for (Types::Index indexSegment = 0; indexSegment < _segments.get_vec().size(); ++indexSegment)
+	{
+		if (_vecSegmentChanged[indexSegment])
+			vecStartChargerChanged[_segments.get_vec()[indexSegment].get_startCharger().get_index()] = 1;
+	}
+
+	std::vector<std::vector<FullConArcData>> vecArcsOutgoing(_indexNode);
+	std::vector<uint8_t> vecNodeUpdated(_indexNode, 0);
+
+	// The OpenMP framework apparently only supports integer types in the for loop, not unsigned integers.
+#ifdef DEBUG_BUILD
+	omp_set_num_threads(1);
+#else
+	omp_set_num_threads(_nr_threads);
+#endif // DEBUG_BUILD
+#pragma omp parallel for
+	for (int32_t indexFromNode = 0;
+		 indexFromNode < _indexNode;
+		 indexFromNode++)
+	{
+		if ((_getNodeData(indexFromNode).type == ConNodeType::SEGMENT || _getNodeData(indexFromNode).type == ConNodeType::START_SCHEDULE)
+			&& (indexFromNode >= indexFirstNewNode || vecStartChargerChanged[_getNodeData(indexFromNode).get_endChargerIndex()]))
+		{
+			vecArcsOutgoing[indexFromNode] = _createOutgoingArcs(indexFromNode, duals);
+			vecNodeUpdated[indexFromNode] = 1;
+		}
+	}
+
+	// Finally, replace the outgoing arcs in the boost network:
+	for (Types::Index indexFromNode = 0; indexFromNode < _indexNode; ++indexFromNode)
+	{
+		if (vecNodeUpdated[indexFromNode])
+		{
+			boost::clear_out_edges(indexFromNode, _boostSegmentNetwork);
+			for (auto& arcData : vecArcsOutgoing[indexFromNode])
+			{
+				_addArc(arcData);
+			}
+		}
+	}
+}
+
 void eva::sbn::con::ConnectionBasedSegmentNetwork::_addBranches(const BranchNode& brn, const Duals& duals)
 {
 	std::vector<std::vector<ConnectionBasedNodeFixings>> vecNodeFixings(_optinput.get_vehicles().get_vec().size());
@@ -396,12 +493,8 @@ eva::sbn::con::FullConArcData eva::sbn::con::ConnectionBasedSegmentNetwork::_cre
 
 	// Compute node access:
 	// Intersection of from Node + to Node:
-	for(Types::Index idxVehicle = 0; idxVehicle < _getNodeData(fromNode).get_vecAccess().size(); ++idxVehicle)
-	{
-		// First, check the intersection.
-		if(!_getNodeData(fromNode).has_access(idxVehicle) || !_getNodeData(toNode).has_access(idxVehicle))
-			arcData.revoke_access(idxVehicle);
-	}
+	arcData.intersect_access(_getNodeData(fromNode).get_vehicleAccess());
+	arcData.intersect_access(_getNodeData(toNode).get_vehicleAccess());
 
 	// Check if the arc is feasible:
 	if(arcData.is_feasible())
@@ -430,37 +523,6 @@ eva::sbn::con::FullConArcData eva::sbn::con::ConnectionBasedSegmentNetwork::_cre
 	return arcData;
 }
 
-const bool eva::sbn::con::ConnectionBasedSegmentNetwork::_isDominated(std::vector<FullConArcData>& vecOutgoingArcs, const FullConArcData& candidateArc)
-{
-	// Iterate over all arcs and check if the node 
-	auto iterDominatingArc = vecOutgoingArcs.begin();
-	while (iterDominatingArc != vecOutgoingArcs.end())
-	{
-
-#ifdef DEBUG_BUILD
-		if (iterDominatingArc->fromNode != candidateArc.fromNode)
-			throw LogicError("eva::sbn::con::ConnectionBasedSegmentNetwork::_checkOutgoingDominance", "FromNode not identical!");
-#endif // DEBUG_BUILD
-
-		// a. Check if the new arc is dominated:
-		// If the dominating arc dominates based on the outgoing arc set, return true:
-		if (iterDominatingArc->dominates(candidateArc))
-			return true;
-
-		// b. Check if the arc dominates a current dominating arc:
-		else if (candidateArc.dominates(*iterDominatingArc))
-		{
-			iterDominatingArc = vecOutgoingArcs.erase(iterDominatingArc);
-		}
-		else
-		{
-			++iterDominatingArc;
-		}
-	}
-
-	return false;
-}
-
 const bool eva::sbn::con::ConnectionBasedSegmentNetwork::_isFeasible(const BoostConnectionBasedNode fromNode, const BoostConnectionBasedNode toNode)
 {
 	// Check if the connection is feasible space/and time-wise:
@@ -512,18 +574,61 @@ const bool eva::sbn::con::ConnectionBasedSegmentNetwork::_isFeasible(const Boost
 
 void eva::sbn::con::ConnectionBasedSegmentNetwork::initialise()
 {
-	_segments.initialise(_optinput);
+	_segments.initialise(_optinput, _nr_threads);
+
+	// Group the segments by their start and end charger:
+	_vecSegmentsChargerToCharger.resize(_optinput.get_chargers().get_vec().size(), std::vector<std::vector<Types::Index>>(_optinput.get_chargers().get_vec().size()));
+	for (Types::Index indexSegment = 0; indexSegment < _segments.get_vec().size(); ++indexSegment)
+	{
+		const Segment& segment = _segments.get_vec()[indexSegment];
+		_vecSegmentsChargerToCharger[segment.get_startCharger().get_index()][segment.get_endCharger().get_index()].push_back(indexSegment);
+	}
+
+	_flag_rebuild_required = true;
 }
 
 void eva::sbn::con::ConnectionBasedSegmentNetwork::create_reduced_graph(const Duals& duals, const BranchNode& brn)
 {
-	// 0. Clean-up the network:
-	_clearNetwork();
+	// 0. Solve the subgraphs of all segments:
+	_updateSegments(brn, duals);
 
-	// Important: Order: nodes -> branches -> arcs!!!
-	_addNodes(brn, duals);
-	_addBranches(brn, duals);
-	_addArcs(brn, duals);
+	// Rebuild the full network, if the branch node has changed, or too many nodes have been retired:
+	if (_flag_rebuild_required
+		|| !_optinput.get_config().get_flag_incremental_reduced_graph()
+		|| 2 * _nrRetiredNodes > _indexNode)
+	{
+		// 1. Clean-up the network:
+		_clearNetwork();
+
+		// Important: Order: nodes -> branches -> arcs!!!
+		_addNodes(brn, duals);
+		_addBranches(brn, duals);
+		_addArcs(brn, duals);
+
+		_flag_rebuild_required = false;
+	}
+	else
+	{
+		// 1. Replace the nodes of all segments that have changed:
+		Types::Index indexFirstNewNode = _indexNode;
+		for (Types::Index indexSegment = 0; indexSegment < _segments.get_vec().size(); ++indexSegment)
+		{
+			if (_vecSegmentChanged[indexSegment])
+			{
+				_retireSegmentNodes(indexSegment);
+				_addSegmentNodes(indexSegment);
+			}
+		}
+		_updateLookUps();
+
+		// Important: Order: nodes -> branches -> arcs!!!
+		// Fixing the branches again is idempotent for the unchanged nodes.
+		_addBranches(brn, duals);
+		_updateArcs(brn, duals, indexFirstNewNode);
+	}
+
+	// 2. Determine the processing order of the labelling:
+	_vecTopologicalOrder = labelling::get_topological_order(_boostSegmentNetwork);
 }
 
 std::vector<eva::SubVehicleSchedule> eva::sbn::con::ConnectionBasedSegmentNetwork::find_neg_reduced_cost_schedule_vehicle(const Duals& duals, const Vehicle& vehicle, const BranchNode& brn, const bool include_cost, const bool solve_to_optimal, bool& isSolvedOptimal,const std::chrono::high_resolution_clock::time_point& timeOutClock)
@@ -543,10 +648,10 @@ std::vector<eva::SubVehicleSchedule> eva::sbn::con::ConnectionBasedSegmentNetwor
 	
 	// Solve the resource constraint shortest path problem:
 	ConnectionBasedResourceConstraintPaths shortestPaths;
-	boost::r_c_shortest_paths(
+	ConnectionBasedResourceExtensionVisitor visitor(timeOutClock);
+	const bool isExhaustive = labelling::label_setting_shortest_paths(
 					_boostSegmentNetwork,
-					boost::get(&ConNodeData::index, _boostSegmentNetwork),
-					boost::get(&ConArcData::index, _boostSegmentNetwork),
+					_vecTopologicalOrder,
 					sourceVertex,
 					sinkVertex,
 					shortestPaths.pareto_optimal_solutions,
@@ -554,12 +659,13 @@ std::vector<eva::SubVehicleSchedule> eva::sbn::con::ConnectionBasedSegmentNetwor
 					initialResourceContainer,
 					ConnectionBasedResourceExtensionFunction(duals, vehicle, _optinput, include_cost),
 					ConnectionBasedDominanceCheck(solve_to_optimal, _optinput.get_flag_has_unassigned_maintenance()),
-					boost::default_r_c_shortest_paths_allocator(),
-					ConnectionBasedResourceExtensionVisitor(_optinput.get_config().get_const_nr_cols_per_vehicle_iter(),solve_to_optimal, timeOutClock)
+					ConnectionBasedLabelKey(),
+					visitor,
+					solve_to_optimal ? 0 : _optinput.get_config().get_const_nr_cols_per_vehicle_iter()
 				);
 	
-	// If less than the maximum number of labels are returned, the labelling algorithm must have processed all labels - hence, the subpath is explored optimally. Else, not:
-	if ((!solve_to_optimal && shortestPaths.pareto_optimal_solutions.size() >= _optinput.get_config().get_const_nr_cols_per_vehicle_iter()) || std::chrono::high_resolution_clock::now() >= timeOutClock)
+	// Unless the bounded label setting discarded labels, or the search was stopped at the time-out, the labelling algorithm has processed all labels - hence, the subpath is explored optimally. Else, not:
+	if (!isExhaustive || std::chrono::high_resolution_clock::now() >= timeOutClock)
 	{
 		// Indicate that the labelling algorithm for this vehicle was not solved to optimality. Can only be set to false.
 		isSolvedOptimal = false;
@@ -646,11 +752,14 @@ std::vector<eva::SubVehicleSchedule> eva::sbn::con::ConnectionBasedSegmentNetwor
 
 void eva::sbn::con::ConnectionBasedSegmentNetwork::update_branch_node_fixings(const BranchNode &brn)
 {
+	// The node fixings of the current network belong to the previous branch node:
+	_flag_rebuild_required = true;
+
 	// Iterate over all segments, and update the vehicle fixings:
 	#ifdef DEBUG_BUILD
 	omp_set_num_threads(1);
 #else
-	omp_set_num_threads(_optinput.get_config().get_const_nr_threads());
+	omp_set_num_threads(_nr_threads);
 #endif // DEBUG_BUILD			
 #pragma omp parallel for
 	for (int32_t indexSegment = 0;
@@ -770,7 +879,7 @@ bool eva::sbn::con::ConnectionBasedResourceExtensionFunction::operator()(const B
             // If charging takes place, increase the soc:
             if (session.is_charging)
             {
-                new_cont.reducedCost -= _duals.vecCumSumDualsChargerCapacity[targetNodeData.get_startChargerIndex()][session.index_putOnCharge][session.index_takeOffCharge];
+                new_cont.reducedCost -= _duals.get_sumDualsChargerCapacity(targetNodeData.get_startChargerIndex(), session.index_putOnCharge, session.index_takeOffCharge);
             }
         }
         else
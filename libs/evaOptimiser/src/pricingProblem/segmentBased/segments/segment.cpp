@@ -3,14 +3,15 @@
 void eva::sbn::Segment::_initSegmentMetrics(const OptimisationInput &optinput, const std::vector<SegmentActivity> &vecActivities)
 {
 	// Iterate over all segment activities, to determine all 
+	const TravelMatrix &travelMatrix = optinput.get_travelMatrix();
 	Types::Index prevLocationIndex = _startCharger.get_location().get_index();
 	for (const SegmentActivity &curSegmentActivity : vecActivities)
 	{
 		// Update the member variables:
-		_deadlegFixCost += optinput.get_config().get_cost_deadleg_fix() + optinput.get_config().get_cost_deadleg_per_km() * optinput.get_location(prevLocationIndex).get_distanceToLocation(curSegmentActivity.get_startLocationIndex());
+		_deadlegFixCost += optinput.get_config().get_cost_deadleg_fix() + optinput.get_config().get_cost_deadleg_per_km() * travelMatrix.get_distance(prevLocationIndex, curSegmentActivity.get_startLocationIndex());
 
-		_distanceBeforeMaintenance = _hasMaintenance ? _distanceBeforeMaintenance : _distanceBeforeMaintenance + optinput.get_location(prevLocationIndex).get_distanceToLocation(curSegmentActivity.get_startLocationIndex()) + optinput.get_location(curSegmentActivity.get_startLocationIndex()).get_distanceToLocation(curSegmentActivity.get_endLocationIndex());
-		_distanceAfterMaintenance = !_hasMaintenance ? _distanceAfterMaintenance : _distanceAfterMaintenance + optinput.get_location(prevLocationIndex).get_distanceToLocation(curSegmentActivity.get_startLocationIndex()) + optinput.get_location(curSegmentActivity.get_startLocationIndex()).get_distanceToLocation(curSegmentActivity.get_endLocationIndex());
+		_distanceBeforeMaintenance = _hasMaintenance ? _distanceBeforeMaintenance : _distanceBeforeMaintenance + travelMatrix.get_distance(prevLocationIndex, curSegmentActivity.get_startLocationIndex()) + travelMatrix.get_distance(curSegmentActivity.get_startLocationIndex(), curSegmentActivity.get_endLocationIndex());
+		_distanceAfterMaintenance = !_hasMaintenance ? _distanceAfterMaintenance : _distanceAfterMaintenance + travelMatrix.get_distance(prevLocationIndex, curSegmentActivity.get_startLocationIndex()) + travelMatrix.get_distance(curSegmentActivity.get_startLocationIndex(), curSegmentActivity.get_endLocationIndex());
 
 		_hasMaintenance = curSegmentActivity.get_type() == SegmentActivityType::MAINTENANCE ? true : _hasMaintenance;
 
@@ -19,9 +20,9 @@ void eva::sbn::Segment::_initSegmentMetrics(const OptimisationInput &optinput, c
 	}
 
 	// Final member variable updates:
-	_distanceBeforeMaintenance = _hasMaintenance ? _distanceBeforeMaintenance : _distanceBeforeMaintenance + optinput.get_location(prevLocationIndex).get_distanceToLocation(_endCharger.get_location());
-	_distanceAfterMaintenance = !_hasMaintenance ? _distanceAfterMaintenance : _distanceAfterMaintenance + optinput.get_location(prevLocationIndex).get_distanceToLocation(_endCharger.get_location());
-	_deadlegFixCost += optinput.get_config().get_cost_deadleg_fix() + optinput.get_config().get_cost_deadleg_per_km() * optinput.get_location(prevLocationIndex).get_distanceToLocation(_endCharger.get_location());
+	_distanceBeforeMaintenance = _hasMaintenance ? _distanceBeforeMaintenance : _distanceBeforeMaintenance + travelMatrix.get_distanceToCharger(prevLocationIndex, _endCharger.get_index());
+	_distanceAfterMaintenance = !_hasMaintenance ? _distanceAfterMaintenance : _distanceAfterMaintenance + travelMatrix.get_distanceToCharger(prevLocationIndex, _endCharger.get_index());
+	_deadlegFixCost += optinput.get_config().get_cost_deadleg_fix() + optinput.get_config().get_cost_deadleg_per_km() * travelMatrix.get_distanceToCharger(prevLocationIndex, _endCharger.get_index());
 
 	if (optinput.get_flag_has_unassigned_maintenance())
 	{
@@ -38,7 +39,7 @@ void eva::sbn::Segment::_initSegmentMetrics(const OptimisationInput &optinput, c
 void eva::sbn::Segment::_initFeasibileVehicles(const OptimisationInput &optinput)
 {
 	// Step 2: Determine all feasible vehicles:
-	_vecFeasibleVehicle.resize(optinput.get_vehicles().get_vec().size(), Types::AccessType::NOT_ALLOWED);
+	_feasibleVehicles.resize(optinput.get_vehicles().get_vec().size(), false);
 
 	for (const Vehicle &vehicle : optinput.get_vehicles().get_vec())
 	{
@@ -46,7 +47,7 @@ void eva::sbn::Segment::_initFeasibileVehicles(const OptimisationInput &optinput
 		if (vehicle.get_distanceRange() >= (_distanceBeforeMaintenance + _distanceAfterMaintenance) 
 			&& !Helper::compare_floats_equal(vehicle.get_chargingSpeedKwS(_startCharger), 0.0))
 		{
-			_vecFeasibleVehicle[vehicle.get_index()] = Types::AccessType::ALLOWED;
+			_feasibleVehicles.set(vehicle.get_index(), true);
 		}
 	}
 }
@@ -58,7 +59,7 @@ void eva::sbn::Segment::_initChargingBounds(const OptimisationInput &optinput)
 	uint32_t lb, ub;
 	for (const Vehicle &vehicle : optinput.get_vehicles().get_vec())
 	{
-		if (_vecFeasibleVehicle[vehicle.get_index()] == Types::AccessType::ALLOWED)
+		if (_feasibleVehicles.test(vehicle.get_index()))
 		{
 			// Always charging at the startCharger:
 			chargingSpeed = vehicle.get_chargingSpeedKwS(_startCharger);
@@ -79,7 +80,7 @@ void eva::sbn::Segment::_initSubgraph(const OptimisationInput &optinput, const s
 {
 	// Step 1: Initialise the subGraph, and member variables:
 	_subgraph.initialise(vecActivities.size() + 2);
-	_subgraph.initialiseInitialVehicleAccess(_vecFeasibleVehicle);
+	_subgraph.initialiseInitialVehicleAccess(_feasibleVehicles);
 	_subgraph.initialiseChargingDurationBounds(_minlb_rechargeDuration, _maxub_rechargeDuration);
 
 	// Step 2: Iterate over all mid-layers:
@@ -1,6 +1,10 @@
 #include "incl/pricingProblem//segmentBased/segments/segments.h"
 
-void eva::sbn::Segments::_createSegments(const OptimisationInput& optinput)
+#include <omp.h>
+
+#include <algorithm>
+
+void eva::sbn::Segments::_createSegments(const OptimisationInput& optinput, const uint32_t nr_threads)
 {
 	// Step 0: Initialise:
 	std::vector<SegmentActivity> vecSegmentActivities;
@@ -59,52 +63,103 @@ void eva::sbn::Segments::_createSegments(const OptimisationInput& optinput)
 		return a.get_distanceRange() < b.get_distanceRange();
 	})->get_distanceRange();
 
-	// Step 3: Determine the feasible segments:
-	for (const Charger& startCharger : optinput.get_chargers().get_vec())
+	// Step 3: Enumerate the feasible activity chains once per start charger. The chains do not depend on the end charger,
+	// hence the trie is shared by all end chargers. The start chargers are independent, and run in parallel:
+	const std::vector<Charger>& vecChargers = optinput.get_chargers().get_vec();
+	std::vector<SegmentChainTrie> vecChainTries(vecChargers.size());
+
+	// The OpenMP framework apparently only supports integer types in the for loop, not unsigned integers.
+#ifdef DEBUG_BUILD
+	omp_set_num_threads(1);
+#else
+	omp_set_num_threads(nr_threads);
+#endif // DEBUG_BUILD
+#pragma omp parallel for schedule(dynamic)
+	for (int32_t indexStartCharger = 0;
+		indexStartCharger < static_cast<int32_t>(vecChargers.size());
+		indexStartCharger++)
+	{
+		_buildChainTrie(optinput, vecSegmentActivities, vecChargers[indexStartCharger], maxDistanceRange, vecChainTries[indexStartCharger]);
+	}
+
+	// Step 4: Assign the segment indexes ordered by start charger, end charger and enumeration order:
+	std::vector<Types::Index> vecFirstIndex(vecChargers.size());
+	for (const Charger& startCharger : vecChargers)
 	{
-		for (const Charger& endCharger : optinput.get_chargers().get_vec())
+		vecFirstIndex[startCharger.get_index()] = _ctrIndex;
+		for (const std::vector<Types::Index>& vecChains : vecChainTries[startCharger.get_index()].vecEndChargerChains)
+			_ctrIndex += vecChains.size();
+	}
+
+	// Step 5: Create the segments, which includes building their subgraphs, in parallel:
+	std::vector<std::vector<Segment>> vecStartChargerSegments(vecChargers.size());
+#pragma omp parallel for schedule(dynamic)
+	for (int32_t indexStartCharger = 0;
+		indexStartCharger < static_cast<int32_t>(vecChargers.size());
+		indexStartCharger++)
+	{
+		const SegmentChainTrie& trie = vecChainTries[indexStartCharger];
+		std::vector<Segment>& vecSegments = vecStartChargerSegments[indexStartCharger];
+		vecSegments.reserve((indexStartCharger + 1 < static_cast<int32_t>(vecChargers.size()) ? vecFirstIndex[indexStartCharger + 1] : _ctrIndex) - vecFirstIndex[indexStartCharger]);
+
+		Types::Index index = vecFirstIndex[indexStartCharger];
+		for (const Charger& endCharger : vecChargers)
 		{
-			// Create all segments:
-			_recursionGenerateSegments(
-				optinput,
-				vecSegmentActivities,
-				startCharger,
-				endCharger,
-				maxDistanceRange,
-				startCharger.get_location(),
-				0,
-				std::vector<SegmentActivity>()
-			);
+			for (const Types::Index& indexTrieNode : trie.vecEndChargerChains[endCharger.get_index()])
+			{
+				vecSegments.push_back(
+					Segment(
+						index++,
+						optinput,
+						vecChargers[indexStartCharger],
+						endCharger,
+						_getChainActivities(vecSegmentActivities, trie, indexTrieNode)
+					)
+				);
+			}
 		}
 	}
+
+	_vecSegments.reserve(_ctrIndex);
+	for (std::vector<Segment>& vecSegments : vecStartChargerSegments)
+	{
+		for (Segment& segment : vecSegments)
+			_vecSegments.push_back(std::move(segment));
+	}
+}
+
+void eva::sbn::Segments::_buildChainTrie(const OptimisationInput& optinput, const std::vector<SegmentActivity>& vecAllActivities, const Charger& startCharger, const uint32_t& range, SegmentChainTrie& trie) const
+{
+	trie.vecNodes.clear();
+	trie.vecEndChargerChains.assign(optinput.get_chargers().get_vec().size(), std::vector<Types::Index>());
+
+	_recursionExtendChain(
+		optinput,
+		vecAllActivities,
+		range,
+		startCharger.get_location().get_index(),
+		0,
+		false,
+		Constants::BIG_INDEX,
+		trie
+	);
 }
 
-void eva::sbn::Segments::_recursionGenerateSegments(const OptimisationInput& optinput, const std::vector<SegmentActivity>& vecAllActivities, const Charger& startCharger, const Charger& endCharger, const uint32_t& range, const Location curLocation, const uint32_t distance, std::vector<SegmentActivity> vecThisSegmentActivities)
+void eva::sbn::Segments::_recursionExtendChain(const OptimisationInput& optinput, const std::vector<SegmentActivity>& vecAllActivities, const uint32_t& range, const Types::Index& curLocationIndex, const uint32_t distance, const bool hasMaintenance, const Types::Index& indexTrieNode, SegmentChainTrie& trie) const
 {
+	const TravelMatrix& travelMatrix = optinput.get_travelMatrix();
+
 	// Iterate over every activity and check if the SOC is sufficient to perform the following activity as well as the return to the endCharger:
-	for (const SegmentActivity& segmentActivity : vecAllActivities)
+	for (Types::Index indexActivity = 0; indexActivity < vecAllActivities.size(); ++indexActivity)
 	{
-		// 1. Rule: no maintenance twice at the same location within the same segment:
-		if (segmentActivity.get_type() == SegmentActivityType::MAINTENANCE)
-		{
-			bool foundMaintenance = false;
-			for(const auto& act : vecThisSegmentActivities )
-			{
-				if(act.get_type() == SegmentActivityType::MAINTENANCE)
-				{
-					foundMaintenance = true;
-					break;
-				}
-			};
+		const SegmentActivity& segmentActivity = vecAllActivities[indexActivity];
 
-			if(foundMaintenance)
-			{
-				continue;
-			}
-		}
+		// 1. Rule: no maintenance twice at the same location within the same segment:
+		if (segmentActivity.get_type() == SegmentActivityType::MAINTENANCE && hasMaintenance)
+			continue;
 		
 		// 2. Rule: deadleg to the new location must be feasible:
-		uint32_t distanceDischarge = curLocation.get_distanceToLocation(segmentActivity.get_startLocationIndex());
+		uint32_t distanceDischarge = travelMatrix.get_distance(curLocationIndex, segmentActivity.get_startLocationIndex());
 		if (distanceDischarge == Constants::BIG_UINTEGER
 			|| (distanceDischarge > 0 && !optinput.get_config().get_flag_allow_deadlegs())) 
 			continue;
@@ -117,43 +172,51 @@ void eva::sbn::Segments::_recursionGenerateSegments(const OptimisationInput& opt
 		if (newDistance <= range)
 		{
 			// Extension to the segment activity is feasible:
-			std::vector<SegmentActivity> vecNewSegmentActivities = vecThisSegmentActivities;
-			vecNewSegmentActivities.push_back(segmentActivity);
-
-			// Final: Check if the vehicle could make a return to the endCharger:
-			uint32_t deadlegDistanceToEndCharger = optinput.get_location(segmentActivity.get_endLocationIndex()).get_distanceToLocation(endCharger.get_location());
-			if (deadlegDistanceToEndCharger != Constants::BIG_UINTEGER
-				&& (deadlegDistanceToEndCharger == 0 || optinput.get_config().get_flag_allow_deadlegs())
-				&& newDistance + deadlegDistanceToEndCharger <= range)
+			SegmentChainNode chainNode;
+			chainNode.indexParent = indexTrieNode;
+			chainNode.indexActivity = indexActivity;
+			trie.vecNodes.push_back(chainNode);
+			const Types::Index indexNewTrieNode = trie.vecNodes.size() - 1;
+
+			// Final: Check for every endCharger if the vehicle could make a return to it:
+			for (Types::Index indexEndCharger = 0; indexEndCharger < trie.vecEndChargerChains.size(); ++indexEndCharger)
 			{
-				_vecSegments.push_back(
-					Segment(
-						_getNextIndex(),
-						optinput,
-						startCharger,
-						endCharger,
-						vecNewSegmentActivities
-						)
-				);
+				uint32_t deadlegDistanceToEndCharger = travelMatrix.get_distanceToCharger(segmentActivity.get_endLocationIndex(), indexEndCharger);
+				if (deadlegDistanceToEndCharger != Constants::BIG_UINTEGER
+					&& (deadlegDistanceToEndCharger == 0 || optinput.get_config().get_flag_allow_deadlegs())
+					&& newDistance + deadlegDistanceToEndCharger <= range)
+				{
+					trie.vecEndChargerChains[indexEndCharger].push_back(indexNewTrieNode);
+				}
 			}
 
 			// Regardless, continue with the recursion:
-			_recursionGenerateSegments(
+			_recursionExtendChain(
 				optinput,
 				vecAllActivities,
-				startCharger,
-				endCharger,
 				range,
-				optinput.get_location(segmentActivity.get_endLocationIndex()),
+				segmentActivity.get_endLocationIndex(),
 				newDistance,
-				vecNewSegmentActivities
+				hasMaintenance || segmentActivity.get_type() == SegmentActivityType::MAINTENANCE,
+				indexNewTrieNode,
+				trie
 			);
 		}
-
 	}
 }
 
-void eva::sbn::Segments::initialise(const OptimisationInput& optinput)
+std::vector<eva::sbn::SegmentActivity> eva::sbn::Segments::_getChainActivities(const std::vector<SegmentActivity>& vecAllActivities, const SegmentChainTrie& trie, Types::Index indexTrieNode) const
+{
+	// Walk up the trie, and reverse the activities into chain order:
+	std::vector<SegmentActivity> vecActivities;
+	for (; indexTrieNode != Constants::BIG_INDEX; indexTrieNode = trie.vecNodes[indexTrieNode].indexParent)
+		vecActivities.push_back(vecAllActivities[trie.vecNodes[indexTrieNode].indexActivity]);
+
+	std::reverse(vecActivities.begin(), vecActivities.end());
+	return vecActivities;
+}
+
+void eva::sbn::Segments::initialise(const OptimisationInput& optinput, const uint32_t nr_threads)
 {
-	_createSegments(optinput);
+	_createSegments(optinput, nr_threads);
 }
\ No newline at end of file
@@ -1,6 +1,6 @@
 #include "incl/pricingProblem/segmentBased/segments/subGraph/subGraph.h"
 
-#include <boost/graph/r_c_shortest_paths.hpp>
+#include "incl/pricingProblem/labelling/labelSetting.h"
 
 void eva::sbn::subgraph::SegmentSubGraph::initialise(const uint32_t& nrLayers)
 {
@@ -14,7 +14,7 @@ void eva::sbn::subgraph::SegmentSubGraph::addTripNode(const SubScheduleTripNodeD
 				_getNextIndexNode(),
 				_optinput.get_vehicles().get_vec().size(),
 				TripNodeData(trip),
-				_vecDefaultVehicleAccess
+				_defaultVehicleAccess
 			),
 			_boostSubGraph
 		);
@@ -33,7 +33,7 @@ void eva::sbn::subgraph::SegmentSubGraph::addMaintenanceNode(const SubScheduleMa
 				_getNextIndexNode(),
 				_optinput.get_vehicles().get_vec().size(),
 				MaintenanceNodeData(maintenance),
-				_vecDefaultVehicleAccess
+				_defaultVehicleAccess
 			),
 			_boostSubGraph
 		);
@@ -53,7 +53,7 @@ void eva::sbn::subgraph::SegmentSubGraph::addAuxiliaryNodes(const Charger& start
 	Types::Index latestChargingEndIndex, earliestChargingStartIndex, latestChargingStartIndex;
 	for (const BoostSubGraphNode& node : _vecLayers[1])
 	{
-		segmentStartTime = _getNodeData(node).get_startTime() - startCharger.get_location().get_durationToLocation(_getNodeData(node).get_startLocationIndex());
+		segmentStartTime = _getNodeData(node).get_startTime() - _optinput.get_travelMatrix().get_durationFromCharger(startCharger.get_index(), _getNodeData(node).get_startLocationIndex());
 		latestChargingEndIndex = _optinput.get_nextIdxTakeOffChargeBeforeEndTime(startCharger.get_index(), segmentStartTime);
 			
 		if (latestChargingEndIndex == Constants::BIG_INDEX)
@@ -85,7 +85,7 @@ void eva::sbn::subgraph::SegmentSubGraph::addAuxiliaryNodes(const Charger& start
 					_getNextIndexNode(),
 					_optinput.get_vehicles().get_vec().size(),
 					StartSegmentNodeData(startCharger, segmentStartTime, earliestChargingStartIndex,latestChargingStartIndex, latestChargingEndIndex),
-					_vecDefaultVehicleAccess
+					_defaultVehicleAccess
 				),
 				_boostSubGraph
 			)
@@ -96,7 +96,7 @@ void eva::sbn::subgraph::SegmentSubGraph::addAuxiliaryNodes(const Charger& start
 	// Add an end node for every node in the last layer:
 	for (const BoostSubGraphNode& node : _vecLayers[(_vecLayers.size() - 2)])
 	{
-		segmentEndTime = _getNodeData(node).get_endTime() + _optinput.get_location(_getNodeData(node).get_endLocationIndex()).get_durationToLocation(endCharger.get_location());
+		segmentEndTime = _getNodeData(node).get_endTime() + _optinput.get_travelMatrix().get_durationToCharger(_getNodeData(node).get_endLocationIndex(), endCharger.get_index());
 		earliestChargingStartIndex = _optinput.get_nextIdxPutOnChargeAfterStartTime(endCharger.get_index(), segmentEndTime);
 
 		// Update the segment end time to the start of the earliest charging session
@@ -110,7 +110,7 @@ void eva::sbn::subgraph::SegmentSubGraph::addAuxiliaryNodes(const Charger& start
 					_getNextIndexNode(),
 					_optinput.get_vehicles().get_vec().size(),
 					EndSegmentNodeData(endCharger, segmentEndTime),
-					_vecDefaultVehicleAccess
+					_defaultVehicleAccess
 				),
 				_boostSubGraph
 			)
@@ -124,7 +124,7 @@ void eva::sbn::subgraph::SegmentSubGraph::addAuxiliaryNodes(const Charger& start
 				_getNextIndexNode(),
 				_optinput.get_vehicles().get_vec().size(),
 				CollectiveStartSegmentNodeData(startCharger),
-				_vecDefaultVehicleAccess
+				_defaultVehicleAccess
 			),
 			_boostSubGraph
 		);
@@ -135,7 +135,7 @@ void eva::sbn::subgraph::SegmentSubGraph::addAuxiliaryNodes(const Charger& start
 				_getNextIndexNode(),
 				_optinput.get_vehicles().get_vec().size(),
 				CollectiveEndSegmentNodeData(endCharger),
-				_vecDefaultVehicleAccess
+				_defaultVehicleAccess
 			),
 			_boostSubGraph
 		);
@@ -177,7 +177,7 @@ void eva::sbn::subgraph::SegmentSubGraph::addConnections()
 				const NodeData& toData = _getNodeData(to);
 
 				int64_t timeDiff = Helper::diffDateTime(fromData.get_endTime(), toData.get_startTime());
-				int64_t duration = _optinput.get_location(_getNodeData(from).get_endLocationIndex()).get_durationToLocation(_getNodeData(to).get_startLocationIndex());
+				int64_t duration = _optinput.get_travelMatrix().get_duration(_getNodeData(from).get_endLocationIndex(), _getNodeData(to).get_startLocationIndex());
 
 				if ((timeDiff - duration) >= 0)
 				{
@@ -212,20 +212,28 @@ void eva::sbn::subgraph::SegmentSubGraph::addConnections()
 			_boostSubGraph
 		);
 	}
+
+	// The subgraph is complete, hence the processing order of the labelling is fixed:
+	_vecTopologicalOrder = labelling::get_topological_order(_boostSubGraph);
 }
 
-void eva::sbn::subgraph::SegmentSubGraph::updateCurrentNonDominatedSchedulePieces(const BranchNode& brn, const Duals& duals)
+bool eva::sbn::subgraph::SegmentSubGraph::updateCurrentNonDominatedSchedulePieces(const BranchNode& brn, const Duals& duals)
 {
-	// Step 0: Clear the current vector:
-	_vecCurrentNonDominatedSchedulePieces.clear();
+	// Step 0: Collect the pieces in a new vector first, to compare them against the current ones at the end:
+	std::vector<NonDominatedSchedulePiece> vecNonDominatedSchedulePieces;
 
 	// Step 1: Update duals:
+	// If neither the duals nor the fixings have changed since the last labelling, then the current pieces remain valid:
 	_updateDuals(duals);
+	_flag_skipped_last_update = !_updateDualFingerprint() && !_flag_fixings_changed;
+	if (_flag_skipped_last_update)
+		return false;
+
+	_flag_fixings_changed = false;
 
 	// Step 2: Initialise:
-	std::vector<Types::AccessType> vecAccess = _vecDefaultVehicleAccess;
 	SubGraphResourceExtensionFunction ref;
-	SubGraphResourceContainer initialResourceContainer(0.0, 0.0, 0.0, Constants::MAX_TIMESTAMP, Constants::MAX_TIMESTAMP, vecAccess, Constants::BIG_INDEX, Constants::MAX_TIMESTAMP);
+	SubGraphResourceContainer initialResourceContainer(0.0, 0.0, 0.0, Constants::MAX_TIMESTAMP, Constants::MAX_TIMESTAMP, _defaultVehicleAccess, Constants::BIG_INDEX, Constants::MAX_TIMESTAMP);
 	std::vector<std::vector<BoostSubGraphArc>> pareto_optimal_paths;
 	std::vector<SubGraphResourceContainer> pareto_optimal_resource_containers;
 
@@ -233,17 +241,19 @@ void eva::sbn::subgraph::SegmentSubGraph::updateCurrentNonDominatedSchedulePiece
 	// Solve the shortest paths for the source-sink combination:
 	// This creates paths valid for all vehicles (changes could be applied later if branches remove some access to some paths)
 	// These paths here are GLOBAL optimal!
-	boost::r_c_shortest_paths(
+	labelling::DefaultLabelSettingVisitor visitor;
+	labelling::label_setting_shortest_paths(
 		_boostSubGraph,
-		boost::get(&NodeData::index, _boostSubGraph),
-		boost::get(&ArcData::index, _boostSubGraph),
+		_vecTopologicalOrder,
 		_sourceNode,
 		_sinkNode,
 		pareto_optimal_paths,
 		pareto_optimal_resource_containers,
 		initialResourceContainer,
 		ref,
-		SubGraphDominanceCheck()
+		SubGraphDominanceCheck(),
+		SubGraphLabelKey(),
+		visitor
 	);
 	
 	// Store all current non-dominated paths:
@@ -279,14 +289,14 @@ void eva::sbn::subgraph::SegmentSubGraph::updateCurrentNonDominatedSchedulePiece
 		}
 
 		// Create the non dominated object:
-		_vecCurrentNonDominatedSchedulePieces.push_back(
+		vecNonDominatedSchedulePieces.push_back(
 			NonDominatedSchedulePiece(
 				pareto_optimal_resource_containers[i].accDuals,
 				minChargingDuals,
 				maxChargingDuals,
 				pareto_optimal_resource_containers[i].timestampStart,
 				pareto_optimal_resource_containers[i].timestampEnd,
-				pareto_optimal_resource_containers[i].vecAccess,
+				pareto_optimal_resource_containers[i].vehicleAccess,
 				vecTripIndexes,
 				vecMaintenanceIndexes,
 				vecScheduleNodeIndexes,
@@ -294,6 +304,14 @@ void eva::sbn::subgraph::SegmentSubGraph::updateCurrentNonDominatedSchedulePiece
 			)
 		);
 	}
+
+	// Step 4: Only replace the current pieces if they have changed.
+	// Unchanged pieces are kept in place, so that references to them remain valid.
+	if (vecNonDominatedSchedulePieces == _vecCurrentNonDominatedSchedulePieces)
+		return false;
+
+	_vecCurrentNonDominatedSchedulePieces.swap(vecNonDominatedSchedulePieces);
+	return true;
 }
 
 void eva::sbn::subgraph::SegmentSubGraph::_updateDuals(const Duals &duals)
@@ -315,16 +333,16 @@ void eva::sbn::subgraph::SegmentSubGraph::_updateDuals(const Duals &duals)
 				{
 					// Only if the node is generally feasible will the start and end-index be correct.
 					_getNodeData(node).min_charging_dual =
-						duals.vecCumSumDualsChargerCapacity
-							[_getNodeData(node).castStartSegmentNodeData()->get_charger().get_index()]
-							[_getNodeData(node).castStartSegmentNodeData()->get_earliestChargingStartIndex()]
-							[_getNodeData(node).castStartSegmentNodeData()->get_latestChargingEndIndex()];
+						duals.get_sumDualsChargerCapacity(
+							_getNodeData(node).castStartSegmentNodeData()->get_charger().get_index(),
+							_getNodeData(node).castStartSegmentNodeData()->get_earliestChargingStartIndex(),
+							_getNodeData(node).castStartSegmentNodeData()->get_latestChargingEndIndex());
 
 					_getNodeData(node).max_charging_dual =
-						duals.vecCumSumDualsChargerCapacity
-							[_getNodeData(node).castStartSegmentNodeData()->get_charger().get_index()]
-							[_getNodeData(node).castStartSegmentNodeData()->get_latestChargingStartIndex()]
-							[_getNodeData(node).castStartSegmentNodeData()->get_latestChargingEndIndex()];
+						duals.get_sumDualsChargerCapacity(
+							_getNodeData(node).castStartSegmentNodeData()->get_charger().get_index(),
+							_getNodeData(node).castStartSegmentNodeData()->get_latestChargingStartIndex(),
+							_getNodeData(node).castStartSegmentNodeData()->get_latestChargingEndIndex());
 				}
 				break;
 			default:
@@ -337,15 +355,45 @@ void eva::sbn::subgraph::SegmentSubGraph::_updateDuals(const Duals &duals)
 	}
 }
 
+bool eva::sbn::subgraph::SegmentSubGraph::_updateDualFingerprint()
+{
+	// Collect the duals of all nodes in the same order as they are updated:
+	std::vector<double> vecDualFingerprint;
+	vecDualFingerprint.reserve(_vecDualFingerprint.size());
+	for (uint32_t layer = 0; layer < _vecLayers.size() - 1; layer++)
+	{
+		for (const BoostSubGraphNode &node : _vecLayers[layer])
+		{
+			vecDualFingerprint.push_back(_getNodeData(node).acc_dual);
+			vecDualFingerprint.push_back(_getNodeData(node).min_charging_dual);
+			vecDualFingerprint.push_back(_getNodeData(node).max_charging_dual);
+		}
+	}
+
+	// Compare against the duals of the last labelling, and only replace them if any dual has changed beyond the tolerance.
+	// Otherwise, small changes could accumulate over many iterations without ever triggering a labelling:
+	bool changed = vecDualFingerprint.size() != _vecDualFingerprint.size();
+	for (size_t pos = 0; !changed && pos < vecDualFingerprint.size(); ++pos)
+		changed = !Helper::compare_floats_equal(vecDualFingerprint[pos], _vecDualFingerprint[pos]);
+
+	if (changed)
+		_vecDualFingerprint.swap(vecDualFingerprint);
+
+	return changed;
+}
+
 void eva::sbn::subgraph::SegmentSubGraph::updateFixings(const BranchNode &brn)
 {
+	// The fixings change the labelling, hence the next update cannot be skipped:
+	_flag_fixings_changed = true;
+
 	// Step 1:
 	// First, reset the flexible node data:
 	for (uint32_t layer = 1; layer < _vecLayers.size() - 1; layer++)
 	{
 		for (const BoostSubGraphNode &node : _vecLayers[layer])
 		{	
-			_getNodeData(node).reset_default_fixings(_vecDefaultVehicleAccess);
+			_getNodeData(node).reset_default_fixings(_defaultVehicleAccess);
 		}
 	}
 
@@ -556,13 +604,13 @@ bool eva::sbn::subgraph::operator==(const SubGraphResourceContainer& res_cont_1,
 		&& eva::Helper::compare_floats_equal(res_cont_1.maxChargingDuals,  res_cont_2.maxChargingDuals)
 		&& res_cont_1.timestampEnd == res_cont_2.timestampEnd
 		&& res_cont_1.timestampStart == res_cont_2.timestampStart
-		&& (Helper::compare_is_subset(res_cont_1.vecAccess, res_cont_2.vecAccess) && Helper::compare_is_subset(res_cont_2.vecAccess, res_cont_1.vecAccess))
+		&& res_cont_1.vehicleAccess == res_cont_2.vehicleAccess
 		&& res_cont_1.indexFixedVehicle == res_cont_2.indexFixedVehicle;
 }
 
 bool eva::sbn::subgraph::operator<(const SubGraphResourceContainer& res_cont_1, const SubGraphResourceContainer& res_cont_2)
 {
-	if (Helper::compare_is_subset(res_cont_1.vecAccess, res_cont_2.vecAccess))
+	if (Helper::compare_is_subset(res_cont_1.vehicleAccess, res_cont_2.vehicleAccess))
 	{
 		if (Helper::compare_floats_smaller(res_cont_1.accDuals + res_cont_1.minChargingDuals, res_cont_2.accDuals + res_cont_2.maxChargingDuals) 
 		|| res_cont_1.timestampEnd > res_cont_2.timestampEnd 
@@ -583,20 +631,12 @@ bool eva::sbn::subgraph::SubGraphResourceExtensionFunction::operator()(const Boo
 
 	// Extend the access of the next label:
 	// The label access is defined by the intersection of old and new:
-	new_cont.isFeasible = false;
-	for(Types::Index idxVehicle = 0; idxVehicle < toData.get_vecAccess().size(); ++idxVehicle)
-	{
-		 // Only need to update if the access is different. Otherwise, it's already copied correctly.
-		if(old_cont.vecAccess[idxVehicle] != toData.get_vecAccess()[idxVehicle])
-			new_cont.vecAccess[idxVehicle] = Types::AccessType::NOT_ALLOWED;
-
-		if(!new_cont.isFeasible && new_cont.vecAccess[idxVehicle] == Types::AccessType::ALLOWED)
-			new_cont.isFeasible = true;
-	}
+	new_cont.vehicleAccess &= toData.get_vehicleAccess();
+	new_cont.isFeasible = new_cont.vehicleAccess.any();
 
 	// Check if the node is infeasible:
 	// May have become infeasible because there is no vehicle anymore allowed on the path.
-	// Use new_cont.vecAccess to check:
+	// Use new_cont.vehicleAccess to check:
 	if(!new_cont.isFeasible)
 		return false;
 
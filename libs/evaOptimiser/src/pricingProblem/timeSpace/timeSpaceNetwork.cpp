@@ -80,6 +80,7 @@ void eva::tsn::TimeSpaceNetwork::_addVehicleStartEndNodes()
 void eva::tsn::TimeSpaceNetwork::_addDeadlegs()
 {
 	const auto &allTimeSpaceNodes = boost::make_iterator_range(boost::vertices(_boostTimeSpaceNetwork));
+	const TravelMatrix &travelMatrix = _optinput.get_travelMatrix();
 
 	int64_t duration = Constants::BIG_UINTEGER;
 	uint32_t distance = Constants::BIG_UINTEGER;
@@ -105,11 +106,11 @@ void eva::tsn::TimeSpaceNetwork::_addDeadlegs()
 					else
 						timeDiff = 0;
 
-					const Location &fromLocation = _optinput.get_location(_getNodeData(fromNode).get_endLocationIndex());
-					const Location &toLocation = _optinput.get_location(_getNodeData(toNode).get_startLocationIndex());
+					const Types::Index fromLocationIndex = _getNodeData(fromNode).get_endLocationIndex();
+					const Types::Index toLocationIndex = _getNodeData(toNode).get_startLocationIndex();
 
-					duration = fromLocation.get_durationToLocation(toLocation);
-					distance = fromLocation.get_distanceToLocation(toLocation);
+					duration = travelMatrix.get_duration(fromLocationIndex, toLocationIndex);
+					distance = travelMatrix.get_distance(fromLocationIndex, toLocationIndex);
 
 					if (distance != Constants::BIG_UINTEGER && (distance == 0 || _optinput.get_config().get_flag_allow_deadlegs()) && (timeDiff - duration) >= 0)
 					{
@@ -147,6 +148,7 @@ void eva::tsn::TimeSpaceNetwork::_addDeadlegs()
 void eva::tsn::TimeSpaceNetwork::_addCharging()
 {
 	const auto &allTimeSpaceNodes = boost::make_iterator_range(boost::vertices(_boostTimeSpaceNetwork));
+	const TravelMatrix &travelMatrix = _optinput.get_travelMatrix();
 
 	int64_t durationToCharger, durationFromCharger;
 	uint32_t distanceToCharger, distanceFromCharger;
@@ -155,10 +157,6 @@ void eva::tsn::TimeSpaceNetwork::_addCharging()
 	int64_t timeDiff;
 	Types::Index earliestPutOnChargeIndex, latestTakeOffChargeIndex;
 
-	// Initialise the vector before adding charging nodes:
-	_vecChargingNodesFrom.resize(_optinput.get_chargers().get_vec().size(), std::vector<std::vector<BoostTimeSpaceNode>>(_indexNode));
-	_vecChargingNodesTo.resize(_optinput.get_chargers().get_vec().size(), std::vector<std::vector<BoostTimeSpaceNode>>(_indexNode));
-
 	for (const BoostTimeSpaceNode &fromNode : allTimeSpaceNodes)
 	{
 		for (const BoostTimeSpaceNode &toNode : allTimeSpaceNodes)
@@ -170,18 +168,19 @@ void eva::tsn::TimeSpaceNetwork::_addCharging()
 				_getNodeData(fromNode).type != TimeSpaceNodeType::CHARGER_END_SCHEDULE &&
 				_getNodeData(toNode).type != TimeSpaceNodeType::START_SCHEDULE)
 			{
-				const Location &fromLocation = _optinput.get_location(_getNodeData(fromNode).get_endLocationIndex());
-				const Location &toLocation = _optinput.get_location(_getNodeData(toNode).get_startLocationIndex());
+				const Types::Index fromLocationIndex = _getNodeData(fromNode).get_endLocationIndex();
+				const Types::Index toLocationIndex = _getNodeData(toNode).get_startLocationIndex();
 
 				timeDiff = Helper::diffDateTime(_getNodeData(fromNode).get_endTime(), _getNodeData(toNode).get_startTime());
 
 				// Connect to every charger in reach:
 				for (const Charger &charger : _optinput.get_chargers().get_vec())
 				{
-					durationToCharger = fromLocation.get_durationToLocation(charger.get_location());
-					durationFromCharger = charger.get_location().get_durationToLocation(toLocation);
-					distanceToCharger = fromLocation.get_distanceToLocation(charger.get_location());
-					distanceFromCharger = charger.get_location().get_distanceToLocation(toLocation);
+					// The charger tables hold the travel to and from all chargers of a location contiguously:
+					durationToCharger = travelMatrix.get_durationToCharger(fromLocationIndex, charger.get_index());
+					durationFromCharger = travelMatrix.get_durationFromCharger(charger.get_index(), toLocationIndex);
+					distanceToCharger = travelMatrix.get_distanceToCharger(fromLocationIndex, charger.get_index());
+					distanceFromCharger = travelMatrix.get_distanceFromCharger(charger.get_index(), toLocationIndex);
 
 					if (distanceToCharger != Constants::BIG_UINTEGER && (distanceToCharger == 0 || _optinput.get_config().get_flag_allow_deadlegs()) && distanceFromCharger != Constants::BIG_UINTEGER && (distanceFromCharger == 0 || _optinput.get_config().get_flag_allow_deadlegs()) && (timeDiff - durationToCharger - _optinput.get_config().get_const_put_vehicle_on_charge() - durationFromCharger - _optinput.get_config().get_const_take_vehicle_off_charge()) >= 0)
 					{
@@ -246,286 +245,427 @@ void eva::tsn::TimeSpaceNetwork::_addCharging()
 	}
 }
 
-void eva::tsn::TimeSpaceNetwork::_initialiseNodeAccess()
+void eva::tsn::TimeSpaceNetwork::_addChargingChains()
 {
-	for (auto &node : _boostTimeSpaceNetwork.m_vertices)
+	// Every charger gets one chain of nodes, one per put on charge slot, connected by waiting arcs.
+	// An activity connects to the earliest slot it can reach, and the latest slot that still reaches an activity connects to it.
+	// Hence, the number of arcs grows linearly in the number of activities, instead of quadratically.
+	const std::vector<BoostTimeSpaceNode> vecActivityNodes(boost::vertices(_boostTimeSpaceNetwork).first, boost::vertices(_boostTimeSpaceNetwork).second);
+	const TravelMatrix &travelMatrix = _optinput.get_travelMatrix();
+
+	int64_t durationToCharger, durationFromCharger;
+	uint32_t distanceToCharger, distanceFromCharger;
+	double costToCharger, costFromCharger;
+	Types::Index arrivalIndex, departureIndex;
+
+	for (const Charger &charger : _optinput.get_chargers().get_vec())
 	{
-		if (node.m_property.get_type() == TimeSpaceNodeType::START_SCHEDULE)
+		// 1. Add the chain nodes, and the waiting arcs between subsequent slots:
+		const Types::Index nrSlots = std::min(_optinput.get_vecPutOnChargeNodes(charger.get_index()).size(), _optinput.get_vecTakeOffChargeNodes(charger.get_index()).size());
+		if (nrSlots == 0)
+			continue;
+
+		std::vector<BoostTimeSpaceNode> vecChainNodes(nrSlots);
+		for (Types::Index indexSlot = 0; indexSlot < nrSlots; ++indexSlot)
 		{
-			node.m_property.init_access(_optinput.get_vehicles().get_vec().size(), TimeSpaceNodeAccessType::NOT_ALLOWED);
-			node.m_property.set_access(node.m_property.castVehicleStartNodeData()->get_vehicle().get_index(), TimeSpaceNodeAccessType::ALLOWED);
-			node.m_property.set_max_rc_start_time(Constants::MAX_TIMESTAMP, node.m_property.castVehicleStartNodeData()->get_vehicle().get_index());
+			vecChainNodes[indexSlot] =
+				boost::add_vertex(
+					TimeSpaceNodeData(
+						_getNextIndexNode(),
+						TimeSpaceChargingChainNodeData(
+							charger,
+							indexSlot,
+							_optinput.get_putOnCharge(charger.get_index(), indexSlot))),
+					_boostTimeSpaceNetwork);
+
+			if (indexSlot > 0)
+			{
+				boost::add_edge(vecChainNodes[indexSlot - 1], vecChainNodes[indexSlot],
+								TimeSpaceArcData(
+									_getNextIndexArc(),
+									0,
+									0,
+									0.0),
+								_boostTimeSpaceNetwork);
+			}
 		}
-		else
+
+		// 2. Add the arcs into and out of the chain:
+		for (const BoostTimeSpaceNode &activityNode : vecActivityNodes)
 		{
-			node.m_property.init_access(_optinput.get_vehicles().get_vec().size(), TimeSpaceNodeAccessType::ALLOWED);
-			node.m_property.reset_max_rc_start_time();
-		}
-	}
+			const TimeSpaceNodeType &type = _getNodeData(activityNode).type;
+			if (type == TimeSpaceNodeType::COLLECTIVE_END_SCHEDULE || type == TimeSpaceNodeType::CHARGER_END_SCHEDULE)
+				continue;
 
-	// Init all access to edges
-	auto ei = boost::edges(_boostTimeSpaceNetwork);
-	for(auto it = ei.first; it != ei.second; ++it)
-	{
-		_getArcData(*it).init_access(_optinput.get_vehicles().get_vec().size(),Types::AccessType::ALLOWED);
+			// a. Arrival at the earliest reachable put on charge slot:
+			const Types::Index fromLocationIndex = _getNodeData(activityNode).get_endLocationIndex();
+			durationToCharger = travelMatrix.get_durationToCharger(fromLocationIndex, charger.get_index());
+			distanceToCharger = travelMatrix.get_distanceToCharger(fromLocationIndex, charger.get_index());
+
+			if (distanceToCharger != Constants::BIG_UINTEGER && (distanceToCharger == 0 || _optinput.get_config().get_flag_allow_deadlegs()))
+			{
+				arrivalIndex = _optinput.get_nextIdxPutOnChargeAfterStartTime(charger.get_index(), _getNodeData(activityNode).get_endTime() + durationToCharger);
+				if (arrivalIndex != Constants::BIG_INDEX && arrivalIndex < nrSlots)
+				{
+					if (type == TimeSpaceNodeType::START_SCHEDULE && fromLocationIndex == charger.get_location().get_index())
+						// With the last activity of a schedule, the deadleg is already accounted for:
+						costToCharger = 0;
+					else
+						costToCharger = _optinput.get_config().get_cost_deadleg_fix() + distanceToCharger * _optinput.get_config().get_cost_deadleg_per_km();
+
+					_vecChargingArcsFrom[charger.get_index()][activityNode].push_back(
+						boost::add_edge(activityNode, vecChainNodes[arrivalIndex],
+										TimeSpaceArcData(
+											_getNextIndexArc(),
+											durationToCharger,
+											distanceToCharger,
+											costToCharger),
+										_boostTimeSpaceNetwork).first);
+				}
+			}
+
+			// b. Departure from the latest take off charge slot that reaches the activity:
+			if (type == TimeSpaceNodeType::START_SCHEDULE)
+				continue;
+
+			const Types::Index toLocationIndex = _getNodeData(activityNode).get_startLocationIndex();
+			durationFromCharger = travelMatrix.get_durationFromCharger(charger.get_index(), toLocationIndex);
+			distanceFromCharger = travelMatrix.get_distanceFromCharger(charger.get_index(), toLocationIndex);
+
+			if (distanceFromCharger != Constants::BIG_UINTEGER && (distanceFromCharger == 0 || _optinput.get_config().get_flag_allow_deadlegs()))
+			{
+				departureIndex = _optinput.get_nextIdxTakeOffChargeBeforeEndTime(charger.get_index(), _getNodeData(activityNode).get_startTime() - durationFromCharger);
+				if (departureIndex != Constants::BIG_INDEX)
+				{
+					departureIndex = std::min(departureIndex, nrSlots - 1);
+					costFromCharger = _optinput.get_config().get_cost_deadleg_fix() + distanceFromCharger * _optinput.get_config().get_cost_deadleg_per_km();
+
+					_vecChargingArcsTo[charger.get_index()][activityNode].push_back(
+						boost::add_edge(vecChainNodes[departureIndex], activityNode,
+										TimeSpaceArcData(
+											_getNextIndexArc(),
+											durationFromCharger,
+											distanceFromCharger,
+											costFromCharger),
+										_boostTimeSpaceNetwork).first);
+				}
+			}
+		}
 	}
 }
 
-void eva::tsn::TimeSpaceNetwork::_resetAccess()
+void eva::tsn::TimeSpaceNetwork::_initialiseNodeAccess()
 {
 	for (auto &node : _boostTimeSpaceNetwork.m_vertices)
 	{
 		if (node.m_property.get_type() == TimeSpaceNodeType::START_SCHEDULE)
 		{
-			node.m_property.reset_access(TimeSpaceNodeAccessType::NOT_ALLOWED);
+			node.m_property.init_access(_optinput.get_vehicles().get_vec().size(), TimeSpaceNodeAccessType::NOT_ALLOWED);
 			node.m_property.set_access(node.m_property.castVehicleStartNodeData()->get_vehicle().get_index(), TimeSpaceNodeAccessType::ALLOWED);
-			node.m_property.set_max_rc_start_time(Constants::MAX_TIMESTAMP,node.m_property.castVehicleStartNodeData()->get_vehicle().get_index());
+			node.m_property.set_max_rc_start_time(Constants::MAX_TIMESTAMP, node.m_property.castVehicleStartNodeData()->get_vehicle().get_index());
 		}
 		else
 		{
-			node.m_property.reset_access(TimeSpaceNodeAccessType::ALLOWED);
+			node.m_property.init_access(_optinput.get_vehicles().get_vec().size(), TimeSpaceNodeAccessType::ALLOWED);
 			node.m_property.reset_max_rc_start_time();
 		}
 	}
 
-	// Reset all access to edges
+	// Init all access to edges
 	auto ei = boost::edges(_boostTimeSpaceNetwork);
 	for(auto it = ei.first; it != ei.second; ++it)
 	{
-		_getArcData(*it).reset_access(Types::AccessType::ALLOWED);
+		_getArcData(*it).init_access(_optinput.get_vehicles().get_vec().size(),Types::AccessType::ALLOWED);
 	}
 }
 
-void eva::tsn::TimeSpaceNetwork::initialise()
+void eva::tsn::TimeSpaceNetwork::_logNodeAccess(const BoostTimeSpaceNode node)
 {
-	// 1. Nodes:
-	_addVehicleStartEndNodes();
-	_addTripNodes();
-	_addMaintenanceNodes();
-
-	// 2. Arcs:
-	_addDeadlegs();
-	_addCharging();
-
-	// 3. Update Node Access:
-	_initialiseNodeAccess();
+	const TimeSpaceNodeData &nodeData = _getNodeData(node);
+
+	TimeSpaceNodeAccessRecord record;
+	record.node = node;
+	record.access = nodeData.access;
+	record.indexFixedVehicle = nodeData.get_index_fixed_vehicle();
+	record.maxRcStartTime = nodeData.get_max_rc_start_time();
+	_vecNodeAccessLog.push_back(record);
 }
 
-void eva::tsn::TimeSpaceNetwork::updateAccess(const BranchNode &brn)
+void eva::tsn::TimeSpaceNetwork::_logArcAccess(const BoostTimeSpaceArc arc)
 {
-	// First, reset the node access and rc start times:
-	_resetAccess();
+	TimeSpaceArcAccessRecord record;
+	record.arc = arc;
+	record.access = _getArcData(arc).get_vehicleAccess();
+	_vecArcAccessLog.push_back(record);
+}
 
-	// Keep a list of the fixed vertices for every vehicle:
-	std::vector<std::vector<TimeSpaceNodeFixings>> vecNodeFixings(_optinput.get_vehicles().get_vec().size());
+void eva::tsn::TimeSpaceNetwork::_applyBranch(const BranchKey &key)
+{
+	TimeSpaceAppliedBranch appliedBranch;
+	appliedBranch.key = key;
+	appliedBranch.sizeNodeLog = _vecNodeAccessLog.size();
+	appliedBranch.sizeArcLog = _vecArcAccessLog.size();
+	_vecAppliedBranches.push_back(appliedBranch);
 
-	// Second, update the node access and rc start times based on the current branching node:
+	// Every node and arc is logged before it is changed:
 	BoostTimeSpaceNode branchedNode;
-	Types::Index indexVehicle;
-	Types::Index indexCharger;
-	for (const Branch &branch : brn.get_vecBranches())
+	switch (key.type)
 	{
-		switch (branch.get_type())
-		{
-		case BranchType::TRIP_UNASSIGNED:
-			branchedNode =_getTripNode(branch.castBranchTripUnassigned()->get_subTripNodeData().get_index());
+	case BranchType::TRIP_UNASSIGNED:
+		// Trip is fixed to be unassigned. No other schedule that includes this trip will be feasible.
+		branchedNode = _getTripNode(key.indexElement);
+		_logNodeAccess(branchedNode);
+		_getNodeData(branchedNode).reset_access(false);
+		break;
 
-			if (branch.get_branchValueBool())
-			{
-				// Trip is fixed to be unassigned. No other schedule that includes this trip will be feasible.
-				_getNodeData(branchedNode).reset_access(false);
-			}
-			break;
+	case BranchType::VEHICLE_TRIP:
+	case BranchType::VEHICLE_MAINTENANCE:
+		branchedNode = key.type == BranchType::VEHICLE_TRIP ? _getTripNode(key.indexElement) : _getMaintenanceNode(key.indexElement);
+		_logNodeAccess(branchedNode);
+
+		if (key.value)
+		{
+			// Vehicle is fixed:
+			// No other vehicle should generate a schedule with the activity.
+			_getNodeData(branchedNode).reset_access(false);
+			_getNodeData(branchedNode).set_access(key.indexVehicle, true);
+
+			TimeSpaceNodeFixings nodeFixing;
+			nodeFixing.fixed_start_time = _getNodeData(branchedNode).get_startTime();
+			nodeFixing.vec_fixed_nodes.push_back(branchedNode);
+			_vecNodeFixings[key.indexVehicle].push_back(nodeFixing);
+			_updateMaxRcStartTimes(key.indexVehicle);
+		}
+		else
+		{
+			_getNodeData(branchedNode).set_access(key.indexVehicle, false);
+		}
+		break;
 
-		case BranchType::VEHICLE_TRIP:
-			branchedNode =_getTripNode(branch.castBranchVehicleTrip()->get_subTripNodeData().get_index());
-			indexVehicle = branch.castBranchVehicleTrip()->get_vehicle().get_index();
+	case BranchType::VEHICLE_CHARGING_AFTER:
+	{
+		const BoostTimeSpaceNode fromNode = _mapScheduleNodeLookup.find(key.indexElement)->second;
 
-			if (branch.get_branchValueBool())
+		if (key.value)
+		{
+			_logNodeAccess(fromNode);
+			_getNodeData(fromNode).reset_access(false);
+			_getNodeData(fromNode).set_access(key.indexVehicle, true);
+
+			// Fix the schedule node:
+			TimeSpaceNodeFixings nodeFixing;
+			nodeFixing.fixed_start_time = _getNodeData(fromNode).get_startTime();
+			nodeFixing.vec_fixed_nodes.push_back(fromNode);
+			_vecNodeFixings[key.indexVehicle].push_back(nodeFixing);
+			_updateMaxRcStartTimes(key.indexVehicle);
+
+			// Now remove access to all outgoing arcs that are not leading to a charging session at the charger:
+			auto out_edges_it = boost::out_edges(fromNode, _boostTimeSpaceNetwork);
+			BoostTimeSpaceNode toNode;
+			for (auto iter = out_edges_it.first; iter != out_edges_it.second; ++iter)
 			{
-				// Vehicle is fixed:
-				// No other vehicle should generate a schedule with the trip.
-				// 1. Update the vehicle access:
-				_getNodeData(branchedNode).reset_access(false);
-				_getNodeData(branchedNode).set_access(indexVehicle, true);
-			
-				// 2. Store the fixed vehicle node:
-				TimeSpaceNodeFixings nodeFixing;
-				nodeFixing.fixed_start_time = _getNodeData(branchedNode).get_startTime();
-				nodeFixing.vec_fixed_nodes.push_back(branchedNode);
-				vecNodeFixings[indexVehicle].push_back(nodeFixing);
+				// Must be guarded because there could be end_schedule nodes that are not having any location assigned
+				toNode = boost::target(*iter, _boostTimeSpaceNetwork);
+				if ((_getNodeData(toNode).type != TimeSpaceNodeType::CHARGING && _getNodeData(toNode).type != TimeSpaceNodeType::CHARGING_CHAIN)
+					|| _getNodeData(toNode).get_startLocationIndex() != _optinput.get_charger(key.indexCharger).get_location().get_index())
+				{
+					_logArcAccess(*iter);
+					_getArcData(*iter).set_access(key.indexVehicle, Types::AccessType::NOT_ALLOWED);
+				}
 			}
-			else
+		}
+		else
+		{
+			// Remove access to the charging nodes for the vehicle:
+			for (const BoostTimeSpaceNode chargingNode : _vecChargingNodesFrom[key.indexCharger][fromNode])
 			{
-				_getNodeData(branchedNode).set_access(indexVehicle, false);
+				_logNodeAccess(chargingNode);
+				_getNodeData(chargingNode).set_access(key.indexVehicle, false);
 			}
-			break;
-
-		case BranchType::VEHICLE_MAINTENANCE:
-			branchedNode = _getMaintenanceNode(branch.castBranchVehicleMaintenance()->get_subMaintenanceNodeData().get_index());
-			indexVehicle = branch.castBranchVehicleMaintenance()->get_vehicle().get_index();
 
-			if (branch.get_branchValueBool())
-			{
-				// Vehicle is fixed:
-				// No other vehicle should generate a schedule with the trip.
-				// 1. Update the vehicle access:
-				_getNodeData(branchedNode).reset_access(false);
-				_getNodeData(branchedNode).set_access(indexVehicle, true);
-
-				// 2. Store the fixed vehicle node:
-				TimeSpaceNodeFixings nodeFixing;
-				nodeFixing.fixed_start_time = _getNodeData(branchedNode).get_startTime();
-				nodeFixing.vec_fixed_nodes.push_back(branchedNode);
-				vecNodeFixings[indexVehicle].push_back(nodeFixing);
-			}
-			else
+			// The charging chain of the charger is shared, hence only the arcs into the chain are removed:
+			for (const BoostTimeSpaceArc &chargingArc : _vecChargingArcsFrom[key.indexCharger][fromNode])
 			{
-				_getNodeData(branchedNode).set_access(indexVehicle, false);
+				_logArcAccess(chargingArc);
+				_getArcData(chargingArc).set_access(key.indexVehicle, Types::AccessType::NOT_ALLOWED);
 			}
-			break;
+		}
+	}
+	break;
 
-		case BranchType::VEHICLE_CHARGING_AFTER:
-		{
-			// Vehicle is fixed:
-			const BranchVehicleChargingAfter *bvca = branch.castBranchVehicleChargingAfter();
-			const BoostTimeSpaceNode fromNode = _mapScheduleNodeLookup.find(bvca->get_indexFromScheduleNode())->second;
-			indexVehicle = bvca->get_vehicle().get_index();
-			indexCharger = bvca->get_charger().get_index();
+	case BranchType::VEHICLE_CHARGING_BEFORE:
+	{
+		const BoostTimeSpaceNode toNode = _mapScheduleNodeLookup.find(key.indexElement)->second;
 
-			// Set the fromNode:
-			if (branch.get_branchValueBool())
+		if (key.value)
+		{
+			_logNodeAccess(toNode);
+			_getNodeData(toNode).reset_access(false);
+			_getNodeData(toNode).set_access(key.indexVehicle, true);
+
+			// Fix the schedule node:
+			TimeSpaceNodeFixings nodeFixing;
+			nodeFixing.fixed_start_time = _getNodeData(toNode).get_startTime();
+			nodeFixing.vec_fixed_nodes.push_back(toNode);
+			_vecNodeFixings[key.indexVehicle].push_back(nodeFixing);
+			_updateMaxRcStartTimes(key.indexVehicle);
+
+			// Now remove access to all incoming arcs that are not coming from a charging session at the charger:
+			auto in_edges_it = boost::in_edges(toNode, _boostTimeSpaceNetwork);
+			BoostTimeSpaceNode fromNode;
+			for (auto iter = in_edges_it.first; iter != in_edges_it.second; ++iter)
 			{
-				_getNodeData(fromNode).reset_access(false);
-				_getNodeData(fromNode).set_access(indexVehicle, true);
-
-				// Fix the schedule node:
-				TimeSpaceNodeFixings nodeFixing;
-				nodeFixing.fixed_start_time = _getNodeData(fromNode).get_startTime();
-				nodeFixing.vec_fixed_nodes.push_back(fromNode);
-				vecNodeFixings[indexVehicle].push_back(nodeFixing);
-
-				// Now remove access to all outgoing arcs that are not leading to a charging session at indexCharger:
-				// Iterate over all charging nodes when charger at fromNode:
-				auto out_edges_it = boost::out_edges(fromNode, _boostTimeSpaceNetwork);
-				BoostTimeSpaceNode toNode;
-				for (auto iter = out_edges_it.first; iter != out_edges_it.second; ++iter) 
+				// Must be guarded because there could be end_schedule nodes that are not having any location assigned
+				fromNode = boost::source(*iter, _boostTimeSpaceNetwork);
+				if ((_getNodeData(fromNode).type != TimeSpaceNodeType::CHARGING && _getNodeData(fromNode).type != TimeSpaceNodeType::CHARGING_CHAIN)
+					|| _getNodeData(fromNode).get_endLocationIndex() != _optinput.get_charger(key.indexCharger).get_location().get_index())
 				{
-					// Unless the target node is a charging node at the charger, remove access to the arc:
-					toNode = boost::target(*iter, _boostTimeSpaceNetwork);
-					if(_getNodeData(toNode).type == TimeSpaceNodeType::CHARGING)
-					{
-						// Must be guarded because there could be end_schedule nodes that are not having any location assigned
-						if(_getNodeData(toNode).get_startLocationIndex() != _optinput.get_charger(indexCharger).get_location().get_index())
-						{
-							_getArcData(*iter).set_access(indexVehicle, Types::AccessType::NOT_ALLOWED);
-						}
-					}
-					else
-					{
-						_getArcData(*iter).set_access(indexVehicle, Types::AccessType::NOT_ALLOWED);
-					}
-				}
-			}
-			else
-			{
-				// Iterate over all charging nodes when charger at fromNode:
-				for(BoostScheduleNode chargingNode :  _vecChargingNodesFrom[indexCharger][fromNode])
-				{	
-					// Remove access to the charging node for the vehicle:
-					_getNodeData(chargingNode).set_access(indexVehicle, false);
+					_logArcAccess(*iter);
+					_getArcData(*iter).set_access(key.indexVehicle, Types::AccessType::NOT_ALLOWED);
 				}
 			}
 		}
-		break;
-
-		case BranchType::VEHICLE_CHARGING_BEFORE:
+		else
 		{
-			// Vehicle is fixed:
-			const BranchVehicleChargingBefore *bvcb = branch.castBranchVehicleChargingBefore();
-			const BoostTimeSpaceNode toNode = _mapScheduleNodeLookup.find(bvcb->get_indexToScheduleNode())->second;
-			indexVehicle = bvcb->get_vehicle().get_index();
-			indexCharger = bvcb->get_charger().get_index();
-
-			// Set the toNode:
-			if (branch.get_branchValueBool())
+			// Remove access to the charging nodes for the vehicle:
+			for (const BoostTimeSpaceNode chargingNode : _vecChargingNodesTo[key.indexCharger][toNode])
 			{
-				_getNodeData(toNode).reset_access(false);
-				_getNodeData(toNode).set_access(indexVehicle, true);
-
-				// Fix the schedule node:
-				TimeSpaceNodeFixings nodeFixing;
-				nodeFixing.fixed_start_time = _getNodeData(toNode).get_startTime();
-				nodeFixing.vec_fixed_nodes.push_back(toNode);
-				vecNodeFixings[indexVehicle].push_back(nodeFixing);
-
-				// Now remove access to all incoming arcs that are not coming from a charging session at indexCharger:
-				// Iterate over all charging nodes when charger at toNode:
-				auto in_edges_it = boost::in_edges(toNode, _boostTimeSpaceNetwork);
-				BoostTimeSpaceNode fromNode;
-				for (auto iter = in_edges_it.first; iter != in_edges_it.second; ++iter) 
-				{
-					// Unless the target node is a charging node at the charger, remove access to the arc:
-					fromNode = boost::source(*iter, _boostTimeSpaceNetwork);
-					if(_getNodeData(fromNode).type == TimeSpaceNodeType::CHARGING)
-					{
-						// Must be guarded because there could be end_schedule nodes that are not having any location assigned
-						if(_getNodeData(fromNode).get_endLocationIndex() != _optinput.get_charger(indexCharger).get_location().get_index())
-						{
-							_getArcData(*iter).set_access(indexVehicle, Types::AccessType::NOT_ALLOWED);
-						}
-					}
-					else
-					{
-						_getArcData(*iter).set_access(indexVehicle, Types::AccessType::NOT_ALLOWED);
-					}
-				}
+				_logNodeAccess(chargingNode);
+				_getNodeData(chargingNode).set_access(key.indexVehicle, false);
 			}
-			else
+
+			// The charging chain of the charger is shared, hence only the arcs out of the chain are removed:
+			for (const BoostTimeSpaceArc &chargingArc : _vecChargingArcsTo[key.indexCharger][toNode])
 			{
-				// Iterate over all charging nodes when charger at fromNode:
-				for(BoostScheduleNode chargingNode :  _vecChargingNodesTo[indexCharger][toNode])
-				{	
-					// Remove access to the charging node for the vehicle:
-					_getNodeData(chargingNode).set_access(indexVehicle, false);
-				}								
+				_logArcAccess(chargingArc);
+				_getArcData(chargingArc).set_access(key.indexVehicle, Types::AccessType::NOT_ALLOWED);
 			}
-		}	
+		}
+	}
+	break;
+
+	default:
 		break;
+	}
+}
 
-		default: 
-			break;
-		}
+void eva::tsn::TimeSpaceNetwork::_rollbackBranch()
+{
+	const TimeSpaceAppliedBranch &appliedBranch = _vecAppliedBranches.back();
+
+	// Restore the logged states in reverse order, such that every node and arc ends with the state before the branch:
+	while (_vecNodeAccessLog.size() > appliedBranch.sizeNodeLog)
+	{
+		const TimeSpaceNodeAccessRecord &record = _vecNodeAccessLog.back();
+		_getNodeData(record.node).access = record.access;
+		_getNodeData(record.node).set_max_rc_start_time(record.maxRcStartTime, record.indexFixedVehicle);
+		_vecNodeAccessLog.pop_back();
 	}
 
-	// Second, for all vehicles, sort their respective fixed nodes by start time.
-	// Then, set the respective max_rc_times for each node:
+	while (_vecArcAccessLog.size() > appliedBranch.sizeArcLog)
+	{
+		const TimeSpaceArcAccessRecord &record = _vecArcAccessLog.back();
+		_getArcData(record.arc).set_vehicleAccess(record.access);
+		_vecArcAccessLog.pop_back();
+	}
+
+	// The fixings of a vehicle are added in the order of the branches:
+	if (appliedBranch.key.adds_fixing())
+		_vecNodeFixings[appliedBranch.key.indexVehicle].pop_back();
+
+	_vecAppliedBranches.pop_back();
+}
+
+void eva::tsn::TimeSpaceNetwork::_updateMaxRcStartTimes(const Types::Index &indexVehicle)
+{
+	// Sort the fixed nodes of the vehicle by start time.
+	// Then, set the respective max_rc_times for each node. Only the start node and the fixed nodes of the vehicle are changed:
+	std::vector<TimeSpaceNodeFixings> vecSortedFixings = _vecNodeFixings[indexVehicle];
+	std::stable_sort(vecSortedFixings.begin(), vecSortedFixings.end(),
+					 [&](const TimeSpaceNodeFixings &l, const TimeSpaceNodeFixings &r)
+					 {
+						 return l.fixed_start_time < r.fixed_start_time;
+					 });
+
 	std::vector<BoostTimeSpaceNode> vecPrevNodes;
-	for (const Vehicle& vehicle : _optinput.get_vehicles().get_vec())
+	vecPrevNodes.push_back(_vecStartNodes[indexVehicle]);
+	for (const TimeSpaceNodeFixings &nodeFixing : vecSortedFixings)
 	{
-		std::sort(vecNodeFixings[vehicle.get_index()].begin(), vecNodeFixings[vehicle.get_index()].end(),
-				  [&](const TimeSpaceNodeFixings &l, const TimeSpaceNodeFixings &r)
-				  {
-					  return l.fixed_start_time < r.fixed_start_time;
-				  });
-		
-		vecPrevNodes.clear();
-		vecPrevNodes.push_back(_vecStartNodes[vehicle.get_index()]);
-		for (const TimeSpaceNodeFixings& nodeFixing : vecNodeFixings[vehicle.get_index()]) {
-			// Update the time of all prev nodes:
-			for(const auto& prevNode : vecPrevNodes)
-				_getNodeData(prevNode).set_max_rc_start_time(nodeFixing.fixed_start_time,vehicle.get_index());
-					
-			
-			// Update the current node:
-			for(const auto& curNode : nodeFixing.vec_fixed_nodes)
-				_getNodeData(curNode).set_max_rc_start_time(Constants::MAX_TIMESTAMP,vehicle.get_index());
-			
-			// Update the list of previous nodes:
-			vecPrevNodes.clear();
-			vecPrevNodes = nodeFixing.vec_fixed_nodes;
+		// Update the time of all prev nodes:
+		for (const auto &prevNode : vecPrevNodes)
+		{
+			_logNodeAccess(prevNode);
+			_getNodeData(prevNode).set_max_rc_start_time(nodeFixing.fixed_start_time, indexVehicle);
 		}
+
+		// Update the current node:
+		for (const auto &curNode : nodeFixing.vec_fixed_nodes)
+		{
+			_logNodeAccess(curNode);
+			_getNodeData(curNode).set_max_rc_start_time(Constants::MAX_TIMESTAMP, indexVehicle);
+		}
+
+		// Update the list of previous nodes:
+		vecPrevNodes = nodeFixing.vec_fixed_nodes;
+	}
+}
+
+void eva::tsn::TimeSpaceNetwork::initialise()
+{
+	// 1. Nodes:
+	_addVehicleStartEndNodes();
+	_addTripNodes();
+	_addMaintenanceNodes();
+
+	// 2. Arcs:
+	_addDeadlegs();
+
+	// Initialise the vectors before adding charging nodes and arcs:
+	_vecChargingNodesFrom.resize(_optinput.get_chargers().get_vec().size(), std::vector<std::vector<BoostTimeSpaceNode>>(_indexNode));
+	_vecChargingNodesTo.resize(_optinput.get_chargers().get_vec().size(), std::vector<std::vector<BoostTimeSpaceNode>>(_indexNode));
+	_vecChargingArcsFrom.resize(_optinput.get_chargers().get_vec().size(), std::vector<std::vector<BoostTimeSpaceArc>>(_indexNode));
+	_vecChargingArcsTo.resize(_optinput.get_chargers().get_vec().size(), std::vector<std::vector<BoostTimeSpaceArc>>(_indexNode));
+
+	if (_optinput.get_config().get_flag_tsn_charging_chains())
+		_addChargingChains();
+	else
+		_addCharging();
+
+	// 3. Update Node Access:
+	_initialiseNodeAccess();
+	_vecNodeFixings.resize(_optinput.get_vehicles().get_vec().size());
+
+	// 4. The network does not change anymore, hence the processing order of the labelling is fixed:
+	_vecTopologicalOrder = labelling::get_topological_order(_boostTimeSpaceNetwork);
+}
+
+void eva::tsn::TimeSpaceNetwork::updateAccess(const BranchNode &brn)
+{
+	// Subsequent branch nodes in the search mostly share the leading branches. Hence, only the branches after the
+	// common prefix with the currently applied branches are rolled back and applied, instead of resetting the whole network.
+
+	// 1. Collect the branches that change the network:
+	std::vector<BranchKey> vecKeys;
+	vecKeys.reserve(brn.get_vecBranches().size());
+	for (const Branch &branch : brn.get_vecBranches())
+	{
+		const BranchKey key = get_branchKey(branch);
+		if (key.type != BranchType::UNDEFINED)
+			vecKeys.push_back(key);
 	}
+
+	// 2. Find the common prefix with the applied branches:
+	size_t sizePrefix = 0;
+	while (sizePrefix < vecKeys.size() && sizePrefix < _vecAppliedBranches.size() && _vecAppliedBranches[sizePrefix].key == vecKeys[sizePrefix])
+		++sizePrefix;
+
+	// 3. Roll back the applied branches behind the prefix, last applied first:
+	while (_vecAppliedBranches.size() > sizePrefix)
+		_rollbackBranch();
+
+	// 4. Apply the remaining branches of the branch node:
+	for (size_t posKey = sizePrefix; posKey < vecKeys.size(); ++posKey)
+		_applyBranch(vecKeys[posKey]);
 }
 
 std::vector<eva::SubVehicleSchedule> eva::tsn::TimeSpaceNetwork::find_neg_reduced_cost_schedule_vehicle(const Duals &duals, const Vehicle &vehicle, const BranchNode &brn, const bool include_cost, const bool solve_to_optimal, bool &isSolvedOptimal,const std::chrono::high_resolution_clock::time_point& timeOutClock)
@@ -545,10 +685,10 @@ std::vector<eva::SubVehicleSchedule> eva::tsn::TimeSpaceNetwork::find_neg_reduce
 
 	// Solve the resource constraint shortest path problem:
 	TimeSpaceResourceConstraintPaths shortestPaths;
-	boost::r_c_shortest_paths(
+	TimeSpaceResourceExtensionVisitor visitor(timeOutClock);
+	const bool isExhaustive = labelling::label_setting_shortest_paths(
 		_boostTimeSpaceNetwork,
-		boost::get(&TimeSpaceNodeData::index, _boostTimeSpaceNetwork),
-		boost::get(&TimeSpaceArcData::index, _boostTimeSpaceNetwork),
+		_vecTopologicalOrder,
 		sourceVertex,
 		sinkVertex,
 		shortestPaths.pareto_optimal_solutions,
@@ -556,11 +696,12 @@ std::vector<eva::SubVehicleSchedule> eva::tsn::TimeSpaceNetwork::find_neg_reduce
 		initialResourceContainer,
 		TimeSpaceResourceExtensionFunction(duals, vehicle, _optinput, include_cost),
 		TimeSpaceDominanceCheck(solve_to_optimal, _optinput.get_flag_has_unassigned_maintenance()),
-		boost::default_r_c_shortest_paths_allocator(),
-		TimeSpaceResourceExtensionVisitor(_optinput.get_config().get_const_nr_cols_per_vehicle_iter(), solve_to_optimal, timeOutClock));
+		TimeSpaceLabelKey(),
+		visitor,
+		solve_to_optimal ? 0 : _optinput.get_config().get_const_nr_cols_per_vehicle_iter());
 	
-	// If less than the maximum number of labels are returned, the labelling algorithm must have processed all labels - hence, the subpath is explored optimally. Else, not:
-	if ((!solve_to_optimal && shortestPaths.pareto_optimal_solutions.size() >= _optinput.get_config().get_const_nr_cols_per_vehicle_iter()) || std::chrono::high_resolution_clock::now() >= timeOutClock)
+	// Unless the bounded label setting discarded labels, or the search was stopped at the time-out, the labelling algorithm has processed all labels - hence, the subpath is explored optimally. Else, not:
+	if (!isExhaustive || std::chrono::high_resolution_clock::now() >= timeOutClock)
 	{
 		// Indicate that the labelling algorithm for this vehicle was not solved to optimality. Can only be set to false.
 		isSolvedOptimal = false;
@@ -586,6 +727,8 @@ std::vector<eva::SubVehicleSchedule> eva::tsn::TimeSpaceNetwork::find_neg_reduce
 			svs.reducedCost = shortestPaths.pareto_optimal_resource_containers[indexResult].reducedCost;
 
 			Types::BatteryCharge soc = curVehiclePosition.soc;
+			Types::Index indexChargingArrival = Constants::BIG_INDEX;
+			Types::Index indexChargingFromScheduleNode = Constants::BIG_INDEX;
 
 			for (auto iterArc = shortestPaths.pareto_optimal_solutions[indexResult].rbegin(); iterArc != shortestPaths.pareto_optimal_solutions[indexResult].rend(); ++iterArc)
 			{
@@ -593,6 +736,36 @@ std::vector<eva::SubVehicleSchedule> eva::tsn::TimeSpaceNetwork::find_neg_reduce
 				const TimeSpaceNodeData &sourceNodeData = _getNodeData(boost::source(*iterArc, _boostTimeSpaceNetwork));
 				const TimeSpaceNodeData &targetNodeData = _getNodeData(boost::target(*iterArc, _boostTimeSpaceNetwork));
 
+				if (sourceNodeData.type == TimeSpaceNodeType::CHARGING_CHAIN && targetNodeData.type != TimeSpaceNodeType::CHARGING_CHAIN)
+				{
+					// Leaving the charging chain, the session spans from the arrival slot to the departure slot:
+					const auto &chargingChainNodeData = sourceNodeData.castChargingChainNodeData();
+					const Charger &charger = chargingChainNodeData->get_charger();
+
+					ChargingStrategy::Session session = _chargingStrategy.get_chargingSession(
+						_optinput.get_putOnCharge(charger.get_index(), indexChargingArrival).get_scheduleNodeData().get_startTime(),
+						_optinput.get_takeOffCharge(charger.get_index(), chargingChainNodeData->get_indexSlot()).get_scheduleNodeData().get_endTime(),
+						vehicle,
+						charger,
+						soc);
+
+					if (session.is_charging)
+					{
+						soc = std::min(vehicle.get_batteryMaxKWh(), soc + session.get_charge(_optinput, charger.get_index()));
+
+						ChargingSchedule cs;
+						cs.indexCharger = charger.get_index();
+						cs.indexPutOnCharge = session.index_putOnCharge;
+						cs.indexTakeOffCharge = session.index_takeOffCharge;
+						cs.indexFromScheduleNode = indexChargingFromScheduleNode;
+						cs.indexToScheduleNode = targetNodeData.get_scheduleNodeIndex();
+						svs.vecChargingSchedule.push_back(cs);
+
+						svs.vecScheduleNodes.push_back(_optinput.get_putOnCharge(charger.get_index(), session.index_putOnCharge).get_scheduleNodeData().get_index());
+						svs.vecScheduleNodes.push_back(_optinput.get_takeOffCharge(charger.get_index(), session.index_takeOffCharge).get_scheduleNodeData().get_index());
+					}
+				}
+
 				soc -= vehicle.get_batteryDischarge(arcData.get_distance() + targetNodeData.get_distance());
 
 				switch (targetNodeData.type)
@@ -635,6 +808,14 @@ std::vector<eva::SubVehicleSchedule> eva::tsn::TimeSpaceNetwork::find_neg_reduce
 					}
 					break;
 				}
+				case TimeSpaceNodeType::CHARGING_CHAIN:
+					// Entering the charging chain, remember the arrival slot and the previous activity:
+					if (sourceNodeData.type != TimeSpaceNodeType::CHARGING_CHAIN)
+					{
+						indexChargingArrival = targetNodeData.castChargingChainNodeData()->get_indexSlot();
+						indexChargingFromScheduleNode = sourceNodeData.get_scheduleNodeIndex();
+					}
+					break;
 				case TimeSpaceNodeType::CHARGER_END_SCHEDULE:
 				case TimeSpaceNodeType::COLLECTIVE_END_SCHEDULE:
 				case TimeSpaceNodeType::START_SCHEDULE:
@@ -732,7 +913,40 @@ bool eva::tsn::TimeSpaceResourceExtensionFunction::_handleChargingNode(TimeSpace
 		if (session.is_charging)
 		{
 			new_cont.soc = std::min(_vehicle.get_batteryMaxKWh(), new_cont.soc + session.get_charge(_optinput, chargingNodeData->get_charger().get_index()));
-			new_cont.reducedCost -= _duals.vecCumSumDualsChargerCapacity[chargingNodeData->get_charger().get_index()][session.index_putOnCharge][session.index_takeOffCharge];
+			new_cont.reducedCost -= _duals.get_sumDualsChargerCapacity(chargingNodeData->get_charger().get_index(), session.index_putOnCharge, session.index_takeOffCharge);
+		}
+
+		return true;
+	}
+	else
+		return false;
+}
+
+bool eva::tsn::TimeSpaceResourceExtensionFunction::_handleChargingChainExit(TimeSpaceResourceContainer &new_cont, const TimeSpaceChargingChainNodeData *chargingChainNodeData) const
+{
+	// The session window matches the one of a charging node with the same put on and take off charge slots:
+	const Charger &charger = chargingChainNodeData->get_charger();
+	const auto &arrivalPutOnCharge = _optinput.get_putOnCharge(charger.get_index(), new_cont.indexChargingArrival);
+	const auto &departureTakeOffCharge = _optinput.get_takeOffCharge(charger.get_index(), chargingChainNodeData->get_indexSlot());
+	new_cont.indexChargingArrival = Constants::BIG_INDEX;
+
+	if (arrivalPutOnCharge.get_scheduleNodeData().get_endTime() >= departureTakeOffCharge.get_scheduleNodeData().get_startTime())
+		return false;
+
+	ChargingStrategy::Session session = _chargingStrategy.get_chargingSession(
+		arrivalPutOnCharge.get_scheduleNodeData().get_startTime(),
+		departureTakeOffCharge.get_scheduleNodeData().get_endTime(),
+		_vehicle,
+		charger,
+		new_cont.soc);
+
+	if (session.is_feasible)
+	{
+		// If charging takes place, increase the soc:
+		if (session.is_charging)
+		{
+			new_cont.soc = std::min(_vehicle.get_batteryMaxKWh(), new_cont.soc + session.get_charge(_optinput, charger.get_index()));
+			new_cont.reducedCost -= _duals.get_sumDualsChargerCapacity(charger.get_index(), session.index_putOnCharge, session.index_takeOffCharge);
 		}
 
 		return true;
@@ -790,6 +1004,12 @@ bool eva::tsn::TimeSpaceResourceExtensionFunction::operator()(const BoostTimeSpa
 	// ______________________________
 	// Node Access check completed!!!
 
+	// CHARGING CHAIN: Settle the charging session when leaving the chain:
+	if (sourceNodeData.type == TimeSpaceNodeType::CHARGING_CHAIN && targetNodeData.type != TimeSpaceNodeType::CHARGING_CHAIN)
+	{
+		if (!_handleChargingChainExit(new_cont, sourceNodeData.castChargingChainNodeData()))
+			return false;
+	}
 	
 	// ARC + NODE: SOC
 	new_cont.soc -= _vehicle.get_batteryDischarge(arcData.get_distance() + targetNodeData.get_distance());
@@ -816,6 +1036,10 @@ bool eva::tsn::TimeSpaceResourceExtensionFunction::operator()(const BoostTimeSpa
 		return _handleMaintenanceNode(new_cont, old_cont, targetNodeData.castMaintenanceNodeData());
 	case TimeSpaceNodeType::CHARGING:
 		return _handleChargingNode(new_cont, old_cont, targetNodeData.castChargingNodeData());
+	case TimeSpaceNodeType::CHARGING_CHAIN:
+		if (sourceNodeData.type != TimeSpaceNodeType::CHARGING_CHAIN)
+			new_cont.indexChargingArrival = targetNodeData.castChargingChainNodeData()->get_indexSlot();
+		return true;
 	case TimeSpaceNodeType::CHARGER_END_SCHEDULE:
 		return true;
 	case TimeSpaceNodeType::COLLECTIVE_END_SCHEDULE:
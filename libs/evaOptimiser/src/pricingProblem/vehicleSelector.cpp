@@ -0,0 +1,173 @@
+#include "incl/pricingProblem/vehicleSelector.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace eva
+{
+	namespace HelperVS
+	{
+		static const double SMOOTHING_SUCCESS_RATE = 0.3; // Weight of the latest pricing run in the success rate of a vehicle.
+		static const double WEIGHT_DUAL_CHANGE = 0.5; // Weight of the normalised dual change against the success rate in the score.
+		static const uint32_t EXPLORATION_DIVISOR = 4; // One in every EXPLORATION_DIVISOR vehicles of a batch is drawn at random.
+	}
+}
+
+eva::VehicleSelector::VehicleSelector(const OptimisationInput& optinput) :
+	_optinput(optinput),
+	_isAdaptive(optinput.get_config().get_flag_adaptive_vehicle_selection()),
+	_generator(std::random_device()()),
+	_previousDuals(optinput)
+{
+	// Vehicles that were never priced start with a full success rate, such that each vehicle is priced early on:
+	_vecSuccessRate.resize(_optinput.get_vehicles().get_vec().size(), 1.0);
+	_vecRelevantTrips.resize(_optinput.get_vehicles().get_vec().size());
+	_vecRelevantChargers.resize(_optinput.get_vehicles().get_vec().size());
+}
+
+const eva::Types::Index eva::VehicleSelector::_getStartCharger(const Types::Index& indexVehicle) const
+{
+	const ScheduleResourceContainer& vp = _optinput.get_vehiclePosition(_optinput.get_vehicle(indexVehicle));
+	if (vp.lastScheduleNode == Constants::BIG_INDEX)
+		return Constants::BIG_INDEX;
+
+	return _optinput.get_travelMatrix().get_nearestCharger(_optinput.get_scheduleGraphNodeData(vp.lastScheduleNode).get_endLocation().get_index());
+}
+
+std::vector<double> eva::VehicleSelector::_getChargerDualChanges(const Duals& duals) const
+{
+	// Per charger, the absolute change of the duals of all its capacity constraints:
+	std::vector<double> vecResult(duals.vecPrefixSumDualsChargerCapacity.size(), 0.0);
+	for (Types::Index indexCharger = 0; indexCharger < vecResult.size(); ++indexCharger)
+	{
+		const std::vector<double>& vecCur = duals.vecPrefixSumDualsChargerCapacity[indexCharger];
+		const std::vector<double>& vecPrev = _previousDuals.vecPrefixSumDualsChargerCapacity[indexCharger];
+		for (Types::Index k = 0; k + 1 < std::min(vecCur.size(), vecPrev.size()); ++k)
+			vecResult[indexCharger] += std::abs((vecCur[k + 1] - vecCur[k]) - (vecPrev[k + 1] - vecPrev[k]));
+	}
+
+	return vecResult;
+}
+
+const double eva::VehicleSelector::_getDualChange(const Types::Index& indexVehicle, const Duals& duals, const std::vector<double>& vecChargerDualChanges) const
+{
+	double dualChange = std::abs(duals.vecDualsOneSchedulePerVehicle[indexVehicle] - _previousDuals.vecDualsOneSchedulePerVehicle[indexVehicle]);
+
+	for (const Types::Index& indexTrip : _vecRelevantTrips[indexVehicle])
+		dualChange += std::abs(duals.vecDualsTripCoverage[indexTrip] - _previousDuals.vecDualsTripCoverage[indexTrip]);
+
+	// The start charger is only counted once, if the vehicle also charged there:
+	const Types::Index indexStartCharger = _getStartCharger(indexVehicle);
+	if (indexStartCharger < vecChargerDualChanges.size())
+		dualChange += vecChargerDualChanges[indexStartCharger];
+
+	for (const Types::Index& indexCharger : _vecRelevantChargers[indexVehicle])
+	{
+		if (indexCharger != indexStartCharger)
+			dualChange += vecChargerDualChanges[indexCharger];
+	}
+
+	return dualChange;
+}
+
+std::vector<eva::Types::Index> eva::VehicleSelector::get_orderedVehicles(const std::vector<uint8_t>& vecVehicleRotation, const Duals& duals, const uint32_t& batchSize)
+{
+	// a. Create a randomly shuffled vector with all vehicles in rotation:
+	std::vector<Types::Index> vecResult;
+	for (Types::Index idx = 0; idx < vecVehicleRotation.size(); ++idx)
+	{
+		if (vecVehicleRotation[idx] == 1)
+			vecResult.push_back(idx);
+	}
+	std::shuffle(vecResult.begin(), vecResult.end(), _generator);
+
+	if (!_isAdaptive)
+		return vecResult;
+
+	// b. Score the vehicles. The dual change is normalised by the largest change over all vehicles in rotation:
+	std::vector<double> vecDualChange(vecVehicleRotation.size(), 0.0);
+	double maxDualChange = 0.0;
+	if (_hasPreviousDuals)
+	{
+		const std::vector<double> vecChargerDualChanges = _getChargerDualChanges(duals);
+		for (const Types::Index& indexVehicle : vecResult)
+		{
+			vecDualChange[indexVehicle] = _getDualChange(indexVehicle, duals, vecChargerDualChanges);
+			maxDualChange = std::max(maxDualChange, vecDualChange[indexVehicle]);
+		}
+	}
+
+	std::vector<double> vecScore(vecVehicleRotation.size(), 0.0);
+	for (const Types::Index& indexVehicle : vecResult)
+	{
+		vecScore[indexVehicle] = _vecSuccessRate[indexVehicle];
+		if (maxDualChange > Constants::EPS)
+			vecScore[indexVehicle] += HelperVS::WEIGHT_DUAL_CHANGE * vecDualChange[indexVehicle] / maxDualChange;
+	}
+
+	// c. Order the vehicles by non-increasing score. The stable sort keeps the random order between vehicles of equal score:
+	std::stable_sort(vecResult.begin(), vecResult.end(), [&](const Types::Index& lhs, const Types::Index& rhs) { return vecScore[lhs] > vecScore[rhs]; });
+
+	// d. Keep exploring: the last slots of every batch are swapped with a random vehicle further down the order:
+	const uint32_t nrExplore = batchSize / HelperVS::EXPLORATION_DIVISOR;
+	if (nrExplore > 0)
+	{
+		for (size_t startBatch = 0; startBatch + batchSize < vecResult.size(); startBatch += batchSize)
+		{
+			for (size_t pos = startBatch + batchSize - nrExplore; pos < startBatch + batchSize; ++pos)
+			{
+				std::uniform_int_distribution<size_t> distribution(pos, vecResult.size() - 1);
+				std::swap(vecResult[pos], vecResult[distribution(_generator)]);
+			}
+		}
+	}
+
+	// e. The next ordering measures the dual change against the current duals:
+	_previousDuals = duals;
+	_hasPreviousDuals = true;
+
+	return vecResult;
+}
+
+void eva::VehicleSelector::record_pricing(const std::vector<Types::Index>& vecVehicleIndexes, const std::vector<std::vector<SubVehicleSchedule>>& resSchedule)
+{
+	for (const Types::Index& indexVehicle : vecVehicleIndexes)
+	{
+		bool isImproving = false;
+		for (const SubVehicleSchedule& schedule : resSchedule[indexVehicle])
+		{
+			if (Helper::compare_floats_smaller(schedule.reducedCost, 0))
+			{
+				// The trips and chargers of the first improving schedule replace the ones of the previous improving run:
+				if (!isImproving)
+				{
+					_vecRelevantTrips[indexVehicle].clear();
+					_vecRelevantChargers[indexVehicle].clear();
+					isImproving = true;
+				}
+
+				_vecRelevantTrips[indexVehicle].insert(_vecRelevantTrips[indexVehicle].end(), schedule.vecTripNodeIndexes.begin(), schedule.vecTripNodeIndexes.end());
+				for (const ChargingSchedule& cs : schedule.vecChargingSchedule)
+					_vecRelevantChargers[indexVehicle].push_back(cs.indexCharger);
+			}
+		}
+
+		if (isImproving)
+		{
+			// Remove the duplicates over the improving schedules of the vehicle:
+			std::vector<Types::Index>& vecTrips = _vecRelevantTrips[indexVehicle];
+			std::sort(vecTrips.begin(), vecTrips.end());
+			vecTrips.erase(std::unique(vecTrips.begin(), vecTrips.end()), vecTrips.end());
+
+			std::vector<Types::Index>& vecChargers = _vecRelevantChargers[indexVehicle];
+			std::sort(vecChargers.begin(), vecChargers.end());
+			vecChargers.erase(std::unique(vecChargers.begin(), vecChargers.end()), vecChargers.end());
+		}
+
+		_vecSuccessRate[indexVehicle] = (1.0 - HelperVS::SMOOTHING_SUCCESS_RATE) * _vecSuccessRate[indexVehicle] + HelperVS::SMOOTHING_SUCCESS_RATE * (isImproving ? 1.0 : 0.0);
+
+		++_nrVehiclesPriced;
+		if (isImproving)
+			++_nrVehiclesImproving;
+	}
+}